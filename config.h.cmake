@@ -3,9 +3,16 @@
 
 #cmakedefine HAVE_LIBZ 1
 #cmakedefine HAVE_SYS_SOCKET_H 1
+#cmakedefine HAVE_SYS_UN_H 1
 #cmakedefine HAVE_NETINET_IN_H 1
 #cmakedefine HAVE_ARPA_INET_H 1
 #cmakedefine HAVE_POLL_H 1
+#cmakedefine HAVE_SYS_EPOLL_H 1
+#cmakedefine HAVE_SYS_EVENTFD_H 1
+#cmakedefine HAVE_LINUX_IO_URING_H 1
+#cmakedefine HAVE_LINUX_FUTEX_H 1
+#cmakedefine HAVE_RECVMMSG 1
+#cmakedefine HAVE_SHM_OPEN 1
 #cmakedefine HAVE_NETDB_H 1
 #cmakedefine HAVE_SYS_TIME_H 1
 #cmakedefine HAVE_PWD_H 1
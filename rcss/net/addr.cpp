@@ -39,6 +39,9 @@
 #ifdef HAVE_ARPA_INET_H
 #include <arpa/inet.h>
 #endif
+#ifdef HAVE_SYS_UN_H
+#include <sys/un.h>
+#endif
 
 #ifdef __CYGWIN__
 // cygwin is not win32
@@ -50,8 +53,10 @@
 #endif
 
 #include <iostream>
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <cstddef>
 
 namespace rcss {
 namespace net {
@@ -84,15 +89,125 @@ private:
       }
 public:
     Impl( const Addr::AddrType & addr )
-        : m_addr( addr )
+        : m_addr( addr ),
+          m_unix( false )
       { }
 
     Impl( Addr::PortType port,
           Addr::HostType host )
+        : m_unix( false )
       {
           setAddr( htons( port ), htonl( host ) );
       }
 
+    Impl( const struct sockaddr * addr,
+          std::size_t len )
+        : m_unix( false )
+      {
+          setAddr( 0, 0 );
+#ifdef HAVE_SYS_UN_H
+          if ( addr->sa_family == AF_UNIX )
+          {
+              m_unix = true;
+              m_unix_len = std::min( len, sizeof( m_unix_addr ) );
+              std::memset( &m_unix_addr, 0, sizeof( m_unix_addr ) );
+              std::memcpy( &m_unix_addr, addr, m_unix_len );
+              return;
+          }
+#endif
+          if ( addr->sa_family == AF_INET
+               && len >= sizeof( m_addr ) )
+          {
+              std::memcpy( &m_addr, addr, sizeof( m_addr ) );
+          }
+      }
+
+    bool setPath( const std::string & path )
+      {
+#ifdef HAVE_SYS_UN_H
+          std::memset( &m_unix_addr, 0, sizeof( m_unix_addr ) );
+          m_unix_addr.sun_family = AF_UNIX;
+          m_unix = true;
+
+          // the abstract namespace is not null terminated, so its names
+          // may use the whole of sun_path.
+          const bool abstract = ( ! path.empty() && path[0] == '@' );
+          const std::size_t max_len = sizeof( m_unix_addr.sun_path ) - ( abstract ? 0 : 1 );
+          if ( path.length() > max_len )
+          {
+              errno = ENAMETOOLONG;
+              m_unix_len = offsetof( struct sockaddr_un, sun_path );
+              return false;
+          }
+
+          std::memcpy( m_unix_addr.sun_path, path.data(), path.length() );
+          if ( abstract )
+          {
+              m_unix_addr.sun_path[0] = '\0';
+              m_unix_len = offsetof( struct sockaddr_un, sun_path ) + path.length();
+          }
+          else
+          {
+              m_unix_len = offsetof( struct sockaddr_un, sun_path ) + path.length() + 1;
+          }
+          return true;
+#else
+          (void)path;
+          errno = EAFNOSUPPORT;
+          return false;
+#endif
+      }
+
+    bool isUnix() const
+      {
+          return m_unix;
+      }
+
+    std::string getPath() const
+      {
+#ifdef HAVE_SYS_UN_H
+          if ( m_unix )
+          {
+              const std::size_t offset = offsetof( struct sockaddr_un, sun_path );
+              if ( m_unix_len <= offset )
+              {
+                  return std::string();
+              }
+              if ( m_unix_addr.sun_path[0] == '\0' )
+              {
+                  return '@' + std::string( m_unix_addr.sun_path + 1,
+                                            m_unix_len - offset - 1 );
+              }
+              return std::string( m_unix_addr.sun_path,
+                                  ::strnlen( m_unix_addr.sun_path, m_unix_len - offset ) );
+          }
+#endif
+          return std::string();
+      }
+
+    const
+    struct sockaddr * getSockAddr() const
+      {
+#ifdef HAVE_SYS_UN_H
+          if ( m_unix )
+          {
+              return reinterpret_cast< const struct sockaddr * >( &m_unix_addr );
+          }
+#endif
+          return reinterpret_cast< const struct sockaddr * >( &m_addr );
+      }
+
+    std::size_t getSockAddrLen() const
+      {
+#ifdef HAVE_SYS_UN_H
+          if ( m_unix )
+          {
+              return m_unix_len;
+          }
+#endif
+          return sizeof( m_addr );
+      }
+
 
     bool setPort( Addr::PortType port )
       {
@@ -202,6 +317,11 @@ public:
 
 private:
     Addr::AddrType m_addr;
+    bool m_unix;
+#ifdef HAVE_SYS_UN_H
+    struct sockaddr_un m_unix_addr;
+    std::size_t m_unix_len;
+#endif
     mutable std::string m_host_name;
     mutable std::string m_port_name;
     Addr::Error m_error;
@@ -222,11 +342,26 @@ Addr::Addr( const AddrType & addr )
 
 }
 
+Addr::Addr( const struct sockaddr * addr,
+            std::size_t len )
+    : M_impl( new Impl( addr, len ) )
+{
+
+}
+
 Addr::~Addr()
 {
 
 }
 
+Addr
+Addr::makeUnix( const std::string & path )
+{
+    Addr addr;
+    addr.M_impl->setPath( path );
+    return addr;
+}
+
 bool
 Addr::setPort( PortType port )
 {
@@ -283,10 +418,41 @@ Addr::getPortStr( const std::string & proto ) const
     return M_impl->getPortStr( proto );
 }
 
+bool
+Addr::isUnix() const
+{
+    return M_impl->isUnix();
+}
+
+std::string
+Addr::getPath() const
+{
+    return M_impl->getPath();
+}
+
+const
+struct sockaddr *
+Addr::getSockAddr() const
+{
+    return M_impl->getSockAddr();
+}
+
+std::size_t
+Addr::getSockAddrLen() const
+{
+    return M_impl->getSockAddrLen();
+}
+
 bool
 operator==( const Addr & a,
             const Addr & b )
 {
+    if ( a.isUnix() || b.isUnix() )
+    {
+        return ( a.isUnix() == b.isUnix()
+                 && a.getPath() == b.getPath() );
+    }
+
     return ( a.getAddr().sin_port == b.getAddr().sin_port
              && ( a.getAddr().sin_addr.s_addr
                   == b.getAddr().sin_addr.s_addr ) );
@@ -303,6 +469,10 @@ std::ostream &
 operator<<( std::ostream & o,
             const rcss::net::Addr & addr )
 {
+    if ( addr.isUnix() )
+    {
+        return o << '(' << addr.getPath() << ')';
+    }
     return o << '(' << addr.getPort() << ':' << addr.getHostStr() << ')';
 }
 
@@ -22,9 +22,12 @@
 #define RCSS_NET_ADDR_HPP
 
 #include <memory>
+#include <functional>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
+struct sockaddr;
 struct sockaddr_in;
 
 namespace rcss {
@@ -51,8 +54,18 @@ public:
 
     Addr( const AddrType & addr );
 
+    // Any address returned by the socket API, e.g. by recvfrom.  Only
+    // AF_INET and AF_UNIX addresses are understood.
+    Addr( const struct sockaddr * addr,
+          std::size_t len );
+
     ~Addr();
 
+    // A Unix domain socket address.  A path starting with '@' names a
+    // socket in the Linux abstract namespace.
+    static
+    Addr makeUnix( const std::string & path );
+
     bool setPort( PortType port = 0 );
 
     bool setPort( const std::string & port,
@@ -73,6 +86,18 @@ public:
 
     std::string getPortStr( const std::string & proto = "" ) const;
 
+    bool isUnix() const;
+
+    // The path of a Unix domain address, or an empty string for an
+    // unnamed socket or an internet address.
+    std::string getPath() const;
+
+    // The address in the form expected by bind, connect and sendto.
+    const
+    struct sockaddr * getSockAddr() const;
+
+    std::size_t getSockAddrLen() const;
+
 };
 
 
@@ -91,4 +116,22 @@ operator<<( std::ostream & o,
 }
 }
 
+namespace std {
+
+//! hash of the host and port, or of the path, consistent with operator==
+template <>
+struct hash< rcss::net::Addr > {
+    size_t operator()( const rcss::net::Addr & addr ) const
+      {
+          if ( addr.isUnix() )
+          {
+              return hash< string >()( addr.getPath() );
+          }
+          return ( static_cast< size_t >( addr.getHost() ) << 16 )
+              ^ static_cast< size_t >( addr.getPort() );
+      }
+};
+
+}
+
 #endif
@@ -0,0 +1,471 @@
+// -*-c++-*-
+
+/***************************************************************************
+                 iouring.cpp  -  Batched socket sends over io_uring
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 2 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "iouring.hpp"
+
+#include <sys/types.h>
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+
+namespace rcss {
+namespace net {
+
+namespace {
+
+int
+send_now( int fd,
+          const char * msg,
+          std::size_t len )
+{
+    for ( ; ; )
+    {
+        int sent = ::send( fd, msg, len, 0 );
+        if ( sent != -1 )
+        {
+            return sent;
+        }
+
+        if ( errno == EAGAIN
+             || errno == EWOULDBLOCK )
+        {
+            // the socket buffer is full.  the datagram is dropped, as it
+            // could be on the network, and the client is kept.
+            return static_cast< int >( len );
+        }
+
+        if ( errno != EINTR )
+        {
+            return -1;
+        }
+    }
+}
+
+#ifdef HAVE_LINUX_IO_URING_H
+
+inline
+unsigned
+load_acquire( const unsigned * p )
+{
+    return __atomic_load_n( p, __ATOMIC_ACQUIRE );
+}
+
+inline
+void
+store_release( unsigned * p,
+               unsigned v )
+{
+    __atomic_store_n( p, v, __ATOMIC_RELEASE );
+}
+
+inline
+unsigned *
+ring_field( void * base,
+            unsigned offset )
+{
+    return reinterpret_cast< unsigned * >( static_cast< char * >( base ) + offset );
+}
+
+#endif
+
+}
+
+IOURing::IOURing()
+    : M_fd( -1 ),
+      M_sq_ptr( nullptr ),
+      M_sq_size( 0 ),
+      M_cq_ptr( nullptr ),
+      M_cq_size( 0 ),
+      M_sqes( nullptr ),
+      M_sqes_size( 0 ),
+      M_sq_head( nullptr ),
+      M_sq_tail( nullptr ),
+      M_sq_mask( 0 ),
+      M_sq_entries( 0 ),
+      M_sq_array( nullptr ),
+      M_cq_head( nullptr ),
+      M_cq_tail( nullptr ),
+      M_cq_mask( 0 ),
+      M_cqes( nullptr ),
+      M_buffer_used( 0 ),
+      M_submitted( 0 )
+{
+
+}
+
+IOURing::~IOURing()
+{
+    flush();
+    close();
+}
+
+bool
+IOURing::open( unsigned int entries,
+               std::size_t buffer_size )
+{
+    close();
+
+#ifdef HAVE_LINUX_IO_URING_H
+    struct io_uring_params params;
+    std::memset( &params, 0, sizeof( params ) );
+
+    int fd = static_cast< int >( ::syscall( __NR_io_uring_setup, entries, &params ) );
+    if ( fd < 0 )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": io_uring_setup: " << std::strerror( errno ) << std::endl;
+        return false;
+    }
+
+    M_sq_size = params.sq_off.array + params.sq_entries * sizeof( unsigned );
+    M_cq_size = params.cq_off.cqes + params.cq_entries * sizeof( struct io_uring_cqe );
+    if ( params.features & IORING_FEAT_SINGLE_MMAP )
+    {
+        M_sq_size = M_cq_size = std::max( M_sq_size, M_cq_size );
+    }
+
+    M_sq_ptr = ::mmap( nullptr, M_sq_size,
+                       PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       fd, IORING_OFF_SQ_RING );
+    if ( M_sq_ptr == MAP_FAILED )
+    {
+        M_sq_ptr = nullptr;
+    }
+    else if ( params.features & IORING_FEAT_SINGLE_MMAP )
+    {
+        M_cq_ptr = M_sq_ptr;
+    }
+    else
+    {
+        M_cq_ptr = ::mmap( nullptr, M_cq_size,
+                           PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                           fd, IORING_OFF_CQ_RING );
+        if ( M_cq_ptr == MAP_FAILED )
+        {
+            M_cq_ptr = nullptr;
+        }
+    }
+
+    M_sqes_size = params.sq_entries * sizeof( struct io_uring_sqe );
+    if ( M_cq_ptr )
+    {
+        M_sqes = ::mmap( nullptr, M_sqes_size,
+                         PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         fd, IORING_OFF_SQES );
+        if ( M_sqes == MAP_FAILED )
+        {
+            M_sqes = nullptr;
+        }
+    }
+
+    M_fd = fd;
+
+    if ( ! M_sqes )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": io_uring mmap: " << std::strerror( errno ) << std::endl;
+        close();
+        return false;
+    }
+
+    M_sq_head = ring_field( M_sq_ptr, params.sq_off.head );
+    M_sq_tail = ring_field( M_sq_ptr, params.sq_off.tail );
+    M_sq_mask = *ring_field( M_sq_ptr, params.sq_off.ring_mask );
+    M_sq_entries = *ring_field( M_sq_ptr, params.sq_off.ring_entries );
+    M_sq_array = ring_field( M_sq_ptr, params.sq_off.array );
+
+    M_cq_head = ring_field( M_cq_ptr, params.cq_off.head );
+    M_cq_tail = ring_field( M_cq_ptr, params.cq_off.tail );
+    M_cq_mask = *ring_field( M_cq_ptr, params.cq_off.ring_mask );
+    M_cqes = static_cast< char * >( M_cq_ptr ) + params.cq_off.cqes;
+
+    M_buffer.resize( buffer_size );
+    M_buffer_used = 0;
+    M_pending.clear();
+
+    return true;
+#else
+    (void)entries;
+    (void)buffer_size;
+    return false;
+#endif
+}
+
+void
+IOURing::close()
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    if ( M_sqes )
+    {
+        ::munmap( M_sqes, M_sqes_size );
+    }
+    if ( M_cq_ptr && M_cq_ptr != M_sq_ptr )
+    {
+        ::munmap( M_cq_ptr, M_cq_size );
+    }
+    if ( M_sq_ptr )
+    {
+        ::munmap( M_sq_ptr, M_sq_size );
+    }
+    if ( M_fd != -1 )
+    {
+        ::close( M_fd );
+    }
+#endif
+    M_fd = -1;
+    M_sq_ptr = M_cq_ptr = M_sqes = M_cqes = nullptr;
+    M_sq_head = M_sq_tail = M_sq_array = M_cq_head = M_cq_tail = nullptr;
+}
+
+int
+IOURing::queueSend( int fd,
+                    const char * msg,
+                    std::size_t len )
+{
+    if ( ! isOpen()
+         || len > M_buffer.size() )
+    {
+        return send_now( fd, msg, len );
+    }
+
+    if ( M_buffer_used + len > M_buffer.size() )
+    {
+        flush();
+        if ( ! isOpen() )
+        {
+            return send_now( fd, msg, len );
+        }
+    }
+
+    std::memcpy( &M_buffer[M_buffer_used], msg, len );
+
+    Pending p;
+    p.fd_ = fd;
+    p.offset_ = M_buffer_used;
+    p.len_ = len;
+    M_pending.push_back( p );
+
+    M_buffer_used += len;
+
+    return static_cast< int >( len );
+}
+
+void
+IOURing::release( int fd )
+{
+    for ( std::vector< Pending >::const_iterator it = M_pending.begin();
+          it != M_pending.end();
+          ++it )
+    {
+        if ( it->fd_ == fd )
+        {
+            flush();
+            break;
+        }
+    }
+
+    M_failures.erase( std::remove_if( M_failures.begin(), M_failures.end(),
+                                      [fd]( const SendFailure & f )
+                                      {
+                                          return f.fd_ == fd;
+                                      } ),
+                      M_failures.end() );
+}
+
+int
+IOURing::flush()
+{
+    int failed = 0;
+
+    if ( M_pending.empty() )
+    {
+        return failed;
+    }
+
+    M_submitted = 0;
+
+#ifdef HAVE_LINUX_IO_URING_H
+    std::size_t next = 0;
+    while ( isOpen()
+            && next < M_pending.size() )
+    {
+        //
+        // fill the submission queue.
+        // only one batch is in flight at a time, so the completion
+        // queue, which is at least as large, can never overflow.
+        //
+        unsigned tail = *M_sq_tail;
+        const unsigned head = load_acquire( M_sq_head );
+        const std::size_t first = next;
+        std::size_t batch = 0;
+        while ( next < M_pending.size()
+                && tail - head < M_sq_entries )
+        {
+            const unsigned idx = tail & M_sq_mask;
+            struct io_uring_sqe * sqe = static_cast< struct io_uring_sqe * >( M_sqes ) + idx;
+            std::memset( sqe, 0, sizeof( *sqe ) );
+            sqe->opcode = IORING_OP_SEND;
+            sqe->fd = M_pending[next].fd_;
+            sqe->addr = reinterpret_cast< unsigned long >( &M_buffer[M_pending[next].offset_] );
+            sqe->len = static_cast< unsigned >( M_pending[next].len_ );
+            sqe->user_data = next;
+            M_sq_array[idx] = idx;
+
+            ++tail;
+            ++next;
+            ++batch;
+        }
+        store_release( M_sq_tail, tail );
+
+        //
+        // submit and wait for the whole batch
+        //
+        std::size_t done = 0;
+        while ( done < batch )
+        {
+            const unsigned to_submit = tail - load_acquire( M_sq_head );
+            int ret = static_cast< int >( ::syscall( __NR_io_uring_enter, M_fd,
+                                                     to_submit,
+                                                     static_cast< unsigned >( batch - done ),
+                                                     IORING_ENTER_GETEVENTS,
+                                                     nullptr, 0 ) );
+            if ( ret < 0
+                 && errno != EINTR
+                 && errno != EAGAIN
+                 && errno != EBUSY )
+            {
+                std::cerr << __FILE__ << ": " << __LINE__
+                          << ": io_uring_enter: " << std::strerror( errno )
+                          << ". Falling back to send." << std::endl;
+                M_submitted = first + ( load_acquire( M_sq_head ) - head );
+                close();
+                break;
+            }
+
+            M_submitted = first + ( load_acquire( M_sq_head ) - head );
+            reapCompletions( done, failed );
+        }
+    }
+
+#endif
+
+    // anything left over was never handed to a working ring
+    sendDirect( failed );
+
+    M_pending.clear();
+    M_buffer_used = 0;
+
+    return failed;
+}
+
+void
+IOURing::reapCompletions( std::size_t & done,
+                          int & failed )
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    unsigned head = *M_cq_head;
+    const unsigned tail = load_acquire( M_cq_tail );
+
+    while ( head != tail )
+    {
+        const struct io_uring_cqe * cqe
+            = static_cast< const struct io_uring_cqe * >( M_cqes ) + ( head & M_cq_mask );
+        Pending & p = M_pending[cqe->user_data];
+
+        if ( cqe->res < 0 )
+        {
+            // e.g. a full socket buffer or a kernel without IORING_OP_SEND
+            if ( send_now( p.fd_, &M_buffer[p.offset_], p.len_ ) < 0 )
+            {
+                sendFailed( p, failed );
+            }
+        }
+        p.fd_ = -1;
+
+        ++head;
+        ++done;
+    }
+
+    store_release( M_cq_head, head );
+#else
+    (void)done;
+    (void)failed;
+#endif
+}
+
+void
+IOURing::sendDirect( int & failed )
+{
+    // the messages the kernel has already taken may have been sent,
+    // even if their completion was never reaped, so they are not
+    // sent again.
+    for ( std::size_t i = M_submitted; i < M_pending.size(); ++i )
+    {
+        Pending & p = M_pending[i];
+        if ( p.fd_ == -1 )
+        {
+            continue;
+        }
+
+        if ( send_now( p.fd_, &M_buffer[p.offset_], p.len_ ) < 0 )
+        {
+            sendFailed( p, failed );
+        }
+        p.fd_ = -1;
+    }
+}
+
+void
+IOURing::sendFailed( const Pending & p,
+                     int & failed )
+{
+    SendFailure f;
+    f.fd_ = p.fd_;
+    f.err_ = errno;
+    M_failures.push_back( f );
+    ++failed;
+}
+
+void
+IOURing::takeFailures( std::vector< SendFailure > & failures )
+{
+    failures.insert( failures.end(), M_failures.begin(), M_failures.end() );
+    M_failures.clear();
+}
+
+}
+}
@@ -0,0 +1,142 @@
+// -*-c++-*-
+
+/***************************************************************************
+                 iouring.hpp  -  Batched socket sends over io_uring
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 2 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSS_NET_IOURING_HPP
+#define RCSS_NET_IOURING_HPP
+
+#include <rcss/net/sendqueue.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace rcss {
+namespace net {
+
+// A submission/completion ring used to send datagrams on connected
+// sockets.  Messages given to queueSend are copied into the ring's own
+// buffer and handed to the kernel together by flush, so that a whole
+// cycle of output costs one io_uring_enter call instead of one send
+// call per message.  The ring is set up with the raw system calls and
+// does not need liburing.  Where io_uring is not available, open()
+// fails and callers are expected to send directly.
+class IOURing
+    : public SendQueue {
+private:
+
+    struct Pending {
+        int fd_;
+        std::size_t offset_;
+        std::size_t len_;
+    };
+
+    int M_fd;
+
+    void * M_sq_ptr;
+    std::size_t M_sq_size;
+    void * M_cq_ptr;
+    std::size_t M_cq_size;
+    void * M_sqes;
+    std::size_t M_sqes_size;
+
+    unsigned * M_sq_head;
+    unsigned * M_sq_tail;
+    unsigned M_sq_mask;
+    unsigned M_sq_entries;
+    unsigned * M_sq_array;
+
+    unsigned * M_cq_head;
+    unsigned * M_cq_tail;
+    unsigned M_cq_mask;
+    void * M_cqes;
+
+    std::vector< char > M_buffer;
+    std::size_t M_buffer_used;
+    std::vector< Pending > M_pending;
+    // Number of M_pending entries the kernel has taken from the
+    // submission queue during the current flush.
+    std::size_t M_submitted;
+    std::vector< SendFailure > M_failures;
+
+    // not used
+    IOURing( const IOURing & );
+    // not used
+    IOURing & operator=( const IOURing & );
+
+public:
+    IOURing();
+
+    virtual
+    ~IOURing();
+
+    // Sets up a ring with the given number of submission entries and
+    // buffer_size bytes of message storage.  Returns false if io_uring
+    // is not supported by the system.
+    bool open( unsigned int entries,
+               std::size_t buffer_size );
+
+    void close();
+
+    bool isOpen() const
+      {
+          return M_fd != -1;
+      }
+
+    // Number of messages waiting for the next flush.
+    std::size_t pending() const
+      {
+          return M_pending.size();
+      }
+
+    // Queues len bytes of msg to be sent on the connected socket fd.
+    // The ring is flushed first if it is full.  Returns the number of
+    // bytes queued or sent, or -1 on error.
+    virtual
+    int queueSend( int fd,
+                   const char * msg,
+                   std::size_t len );
+
+    // Flushes the ring if anything is queued for fd.
+    virtual
+    void release( int fd );
+
+    virtual
+    void takeFailures( std::vector< SendFailure > & failures );
+
+    // Submits every queued message and waits for their completion.
+    // Messages the kernel refuses are sent again with a plain send.
+    // Returns the number of messages that could not be sent.
+    int flush();
+
+private:
+
+    void reapCompletions( std::size_t & done,
+                          int & failed );
+
+    void sendDirect( int & failed );
+
+    void sendFailed( const Pending & p,
+                     int & failed );
+
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,70 @@
+// -*-c++-*-
+
+/***************************************************************************
+           sendqueue.hpp  -  Deferred sends on connected sockets
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 2 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSS_NET_SENDQUEUE_HPP
+#define RCSS_NET_SENDQUEUE_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace rcss {
+namespace net {
+
+// A datagram that could not be sent later, with the errno of the
+// failed send.  A full socket buffer only drops the datagram and is
+// not reported.
+struct SendFailure {
+    int fd_;
+    int err_;
+};
+
+// Takes the datagrams of connected sockets to send them later.  A
+// SocketStreamBuf with a queue hands its output to the queue instead
+// of sending it itself.
+class SendQueue {
+public:
+    virtual
+    ~SendQueue()
+      { }
+
+    // Queues len bytes of msg to be sent on the connected socket fd.
+    // Returns the number of bytes queued or sent, or -1 on error.
+    virtual
+    int queueSend( int fd,
+                   const char * msg,
+                   std::size_t len ) = 0;
+
+    // Called before fd is closed.  When it returns, nothing queued for
+    // fd is left to be sent, so the number may be reused.
+    virtual
+    void release( int fd ) = 0;
+
+    // Appends the failures since the last call to failures.  Called by
+    // the thread that queues, which closes the sockets.  The failures
+    // of a released fd are dropped, so that they cannot be taken for
+    // a new socket with the same number.
+    virtual
+    void takeFailures( std::vector< SendFailure > & failures ) = 0;
+};
+
+}
+}
+
+#endif
@@ -46,6 +46,7 @@
 typedef int socklen_t;
 #endif
 
+#include <algorithm>
 #include <iostream>
 
 #ifdef __CYGWIN__
@@ -66,6 +67,8 @@ const Socket::SocketDesc Socket::INVALIDSOCKET = INVALID_SOCKET;
 const Socket::SocketDesc Socket::INVALIDSOCKET = -1;
 #endif
 
+const size_t Socket::MAX_BATCH = 64;
+
 
 void
 Socket::closeFD( SocketDesc* s )
@@ -124,8 +127,8 @@ Socket::bind( const Addr & addr )
     if ( isOpen() )
     {
         int err = ::bind( getFD(),
-                          (struct sockaddr *)&( addr.getAddr() ),
-                          sizeof( addr.getAddr() ) );
+                          addr.getSockAddr(),
+                          addr.getSockAddrLen() );
 #ifdef RCSS_WIN
         if ( err == SOCKET_ERROR )
         {
@@ -147,7 +150,7 @@ Socket::getName() const
 {
     if ( isOpen() )
     {
-        Addr::AddrType name;
+        struct sockaddr_storage name;
         socklen_t from_len = sizeof( name );
         int err = ::getsockname( getFD(),
                                  (struct sockaddr *)&name,
@@ -164,7 +167,7 @@ Socket::getName() const
             return Addr();
         }
 #endif
-        return Addr( name );
+        return Addr( (struct sockaddr *)&name, from_len );
     }
     else
     {
@@ -178,8 +181,8 @@ Socket::connect( const Addr & addr )
     if ( isOpen() )
     {
         int err = ::connect( getFD(),
-                             (const struct sockaddr *)&( addr.getAddr() ),
-                             sizeof( addr.getAddr() ) );
+                             addr.getSockAddr(),
+                             addr.getSockAddrLen() );
 #ifdef RCSS_WIN
         if ( err == SOCKET_ERROR )
         {
@@ -205,7 +208,7 @@ Socket::getPeer() const
 {
     if ( isOpen() )
     {
-        Addr::AddrType name;
+        struct sockaddr_storage name;
         socklen_t from_len = sizeof( name );
         int err = ::getpeername( getFD(),
                                  (struct sockaddr *)&name,
@@ -221,7 +224,7 @@ Socket::getPeer() const
             return Addr();
         }
 #endif
-        return Addr( name );
+        return Addr( (struct sockaddr *)&name, from_len );
     }
     else
     {
@@ -375,8 +378,8 @@ Socket::send( const char * msg,
                          len,
 #endif
                          flags,
-                         (struct sockaddr *)&( dest.getAddr() ),
-                         sizeof( dest.getAddr() ) );
+                         dest.getSockAddr(),
+                         dest.getSockAddrLen() );
     }
     else
     {
@@ -389,8 +392,8 @@ Socket::send( const char * msg,
                                  len,
 #endif
                                  flags,
-                                 (struct sockaddr *)&( dest.getAddr() ),
-                                 sizeof( dest.getAddr() ) );
+                                 dest.getSockAddr(),
+                                 dest.getSockAddrLen() );
             if ( sent != -1
                  || ( errno != EINTR
 #ifdef RCSS_WIN
@@ -457,7 +460,7 @@ Socket::recv( char * msg,
 {
     if ( check == DONT_CHECK )
     {
-        Addr::AddrType addr;
+        struct sockaddr_storage addr;
         socklen_t from_len = sizeof( addr );
         int rval = ::recvfrom( getFD(), msg,
 #ifdef RCSS_WIN
@@ -467,14 +470,14 @@ Socket::recv( char * msg,
 #endif
                                flags,
                                (struct sockaddr *)&addr, &from_len );
-        from = Addr( addr );
+        from = Addr( (struct sockaddr *)&addr, from_len );
         return rval;
     }
     else
     {
         for ( ; ; )
         {
-            Addr::AddrType addr;
+            struct sockaddr_storage addr;
             socklen_t from_len = sizeof( addr );
             int received = ::recvfrom( getFD(), msg,
 #ifdef RCSS_WIN
@@ -485,7 +488,7 @@ Socket::recv( char * msg,
                                        flags,
                                        (struct sockaddr *)&addr,
                                        &from_len );
-            from = Addr( addr );
+            from = Addr( (struct sockaddr *)&addr, from_len );
             if ( received != -1
                  || errno != EINTR )
             {
@@ -600,5 +603,73 @@ Socket::recv( int timeout,
 #endif
 }
 
+int
+Socket::recvBatch( char * buf,
+                   size_t len,
+                   size_t count,
+                   int * sizes,
+                   Addr * from,
+                   int flags )
+{
+    count = std::min( count, MAX_BATCH );
+    if ( count == 0 )
+    {
+        return 0;
+    }
+
+#if defined (HAVE_RECVMMSG)
+    mmsghdr msgs[ MAX_BATCH ];
+    iovec iovs[ MAX_BATCH ];
+    struct sockaddr_storage addrs[ MAX_BATCH ];
+
+    for ( size_t i = 0; i < count; ++i )
+    {
+        iovs[i].iov_base = buf + i * len;
+        iovs[i].iov_len = len;
+
+        msgs[i].msg_hdr.msg_name = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof( addrs[i] );
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_control = nullptr;
+        msgs[i].msg_hdr.msg_controllen = 0;
+        msgs[i].msg_hdr.msg_flags = 0;
+        msgs[i].msg_len = 0;
+    }
+
+    int received;
+    do
+    {
+        received = ::recvmmsg( getFD(), msgs, count, flags, nullptr );
+    }
+    while ( received == -1 && errno == EINTR );
+
+    for ( int i = 0; i < received; ++i )
+    {
+        sizes[i] = static_cast< int >( msgs[i].msg_len );
+        if ( from )
+        {
+            from[i] = Addr( (struct sockaddr *)&addrs[i],
+                            msgs[i].msg_hdr.msg_namelen );
+        }
+    }
+    return received;
+#else
+    size_t received = 0;
+    for ( ; received < count; ++received )
+    {
+        const int rval = ( from
+                           ? recv( buf + received * len, len, from[received], flags )
+                           : recv( buf + received * len, len, flags ) );
+        if ( rval < 0 )
+        {
+            break;
+        }
+        sizes[received] = rval;
+    }
+    return ( received == 0 ? -1 : static_cast< int >( received ) );
+#endif
+}
+
 }
 }
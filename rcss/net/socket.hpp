@@ -119,6 +119,21 @@ public:
               size_t len,
               int flags = 0 );
 
+    // Receives up to count datagrams, at most MAX_BATCH, with one
+    // system call where recvmmsg is available, and with a loop over
+    // recv otherwise.  The i-th datagram is stored at buf + i * len,
+    // its size in sizes[i] and, if from is not null, its source address
+    // in from[i].  Returns the number of datagrams received, or -1 if
+    // none could be received.
+    int recvBatch( char * buf,
+                   size_t len,
+                   size_t count,
+                   int * sizes,
+                   Addr * from,
+                   int flags = 0 );
+
+    static const size_t MAX_BATCH;
+
 protected:
     virtual
     bool doOpen( SocketDesc& fd ) = 0;
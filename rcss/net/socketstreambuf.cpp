@@ -25,6 +25,7 @@
 #include "socketstreambuf.hpp"
 
 #include "socket.hpp"
+#include "sendqueue.hpp"
 
 namespace rcss {
 namespace net {
@@ -39,7 +40,8 @@ SocketStreamBuf::SocketStreamBuf( Socket & socket,
       M_inbuf( nullptr ),
       M_outbuf( nullptr ),
       M_remained( 0 ),
-      M_connect( conn )
+      M_connect( conn ),
+      M_queue( nullptr )
 {
     M_outbuf = new char_type[M_bufsize];
     setp( M_outbuf, M_outbuf + M_bufsize );
@@ -55,7 +57,8 @@ SocketStreamBuf::SocketStreamBuf( Socket & socket,
       M_inbuf( nullptr ),
       M_outbuf( nullptr ),
       M_remained( 0 ),
-      M_connect( conn )
+      M_connect( conn ),
+      M_queue( nullptr )
 {
     M_outbuf = new char_type[M_bufsize];
     setp( M_outbuf, M_outbuf + M_bufsize );
@@ -82,6 +85,10 @@ SocketStreamBuf::writeData()
 
     if ( M_socket.isConnected() )
     {
+        if ( M_queue )
+        {
+            return M_queue->queueSend( M_socket.getFD(), M_outbuf, size ) > 0;
+        }
         return M_socket.send( M_outbuf, size ) > 0;
     }
     else
@@ -32,6 +32,7 @@ namespace rcss {
 namespace net {
 
 class Socket;
+class SendQueue;
 
 class SocketStreamBuf
     : public std::streambuf {
@@ -51,6 +52,7 @@ private:
     int M_remained;
     char_type M_remained_char;
     ConnType M_connect;
+    SendQueue * M_queue;
 
     // not used
     SocketStreamBuf( const SocketStreamBuf & );
@@ -80,6 +82,13 @@ public:
           M_connect = conn;
       }
 
+    // When a queue is set, data for a connected socket is handed to it
+    // instead of being sent at once.
+    void setSendQueue( SendQueue * queue )
+      {
+          M_queue = queue;
+      }
+
 private:
 
     bool writeData();
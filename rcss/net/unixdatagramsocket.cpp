@@ -0,0 +1,125 @@
+// -*-c++-*-
+
+/***************************************************************************
+          unixdatagramsocket.cpp  -  A Unix domain datagram socket class
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 2 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "unixdatagramsocket.hpp"
+
+#include <sys/types.h>
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+#ifdef HAVE_SYS_UN_H
+#include <sys/un.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <cerrno>
+
+namespace rcss {
+namespace net {
+
+UnixDatagramSocket::UnixDatagramSocket()
+{
+    open();
+}
+
+UnixDatagramSocket::UnixDatagramSocket( SocketDesc & s )
+    : Socket( s )
+{
+
+}
+
+UnixDatagramSocket::UnixDatagramSocket( const Addr & addr )
+{
+    open();
+    bindPath( addr );
+}
+
+UnixDatagramSocket::~UnixDatagramSocket()
+{
+#ifdef HAVE_UNISTD_H
+    if ( ! M_bound_path.empty() )
+    {
+        ::unlink( M_bound_path.c_str() );
+    }
+#endif
+}
+
+bool
+UnixDatagramSocket::bindPath( const Addr & addr )
+{
+    const std::string path = addr.getPath();
+    const bool file = ( ! path.empty() && path[0] != '@' );
+
+#ifdef HAVE_UNISTD_H
+    if ( file )
+    {
+        // left over from an earlier run
+        ::unlink( path.c_str() );
+    }
+#endif
+
+    if ( ! bind( addr ) )
+    {
+        return false;
+    }
+
+    if ( file )
+    {
+        M_bound_path = path;
+    }
+    return true;
+}
+
+bool
+UnixDatagramSocket::autoBind()
+{
+#if defined(HAVE_SYS_UN_H) && defined(__linux__)
+    // a bare address family asks the kernel for a fresh abstract name
+    struct sockaddr_un addr;
+    addr.sun_family = AF_UNIX;
+    return ::bind( getFD(),
+                   reinterpret_cast< struct sockaddr * >( &addr ),
+                   sizeof( sa_family_t ) ) == 0;
+#else
+    errno = EOPNOTSUPP;
+    return false;
+#endif
+}
+
+bool
+UnixDatagramSocket::doOpen( SocketDesc & fd )
+{
+    close();
+#ifdef HAVE_SYS_UN_H
+    fd = ::socket( AF_UNIX, SOCK_DGRAM, 0 );
+    return fd >= 0;
+#else
+    errno = EAFNOSUPPORT;
+    return false;
+#endif
+}
+
+}
+}
@@ -0,0 +1,74 @@
+// -*-c++-*-
+
+/***************************************************************************
+          unixdatagramsocket.hpp  -  A Unix domain datagram socket class
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 2 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef RCSS_NET_UNIXDATAGRAMSOCKET_HPP
+#define RCSS_NET_UNIXDATAGRAMSOCKET_HPP
+
+#include <rcss/net/socket.hpp>
+
+#include <string>
+
+namespace rcss {
+namespace net {
+
+// A datagram socket in the AF_UNIX family.  Addresses are made with
+// Addr::makeUnix.  Unlike UDP, a socket that has not been bound has no
+// address that a peer could reply to, so sockets that talk to a
+// client should be bound with autoBind first.
+class UnixDatagramSocket
+    : public Socket {
+private:
+    std::string M_bound_path;
+
+    // not used
+    UnixDatagramSocket( const UnixDatagramSocket & );
+    // not used
+    UnixDatagramSocket & operator=( const UnixDatagramSocket & );
+
+public:
+
+    UnixDatagramSocket();
+
+    UnixDatagramSocket( SocketDesc & s );
+
+    UnixDatagramSocket( const Addr & addr );
+
+    // Removes the socket file that was created by bindPath.
+    ~UnixDatagramSocket();
+
+    // Binds to addr.  If addr is a filesystem path, an existing
+    // socket file at that path is removed first, and the new one is
+    // removed when this socket is destroyed.
+    bool bindPath( const Addr & addr );
+
+    // Binds to a unique name in the abstract namespace chosen by the
+    // kernel.  Only available on Linux.
+    bool autoBind();
+
+protected:
+    virtual
+    bool doOpen( SocketDesc & fd );
+};
+
+}
+}
+
+#endif
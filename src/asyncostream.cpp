@@ -0,0 +1,142 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               asyncostream.cpp
+                  Output stream written by a background thread
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "asyncostream.h"
+
+#include "utility.h"
+
+namespace {
+const std::size_t OUTBUF_SIZE = 64 * 1024;
+}
+
+AsyncStreamBuf::AsyncStreamBuf( std::ostream * target )
+    : M_target( target ),
+      M_outbuf( OUTBUF_SIZE ),
+      M_busy( false ),
+      M_stop( false ),
+      M_failed( false )
+{
+    setp( M_outbuf.data(), M_outbuf.data() + M_outbuf.size() );
+
+    try
+    {
+        M_thread = std::thread( &AsyncStreamBuf::run, this );
+    }
+    catch ( std::exception & e )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error starting the writer thread: "
+                  << e.what() << ". Writing directly." << std::endl;
+    }
+}
+
+AsyncStreamBuf::~AsyncStreamBuf()
+{
+    sync();
+
+    if ( M_thread.joinable() )
+    {
+        {
+            std::unique_lock< std::mutex > lock( M_mutex );
+            M_cond.wait( lock, [this] { return ! M_busy; } );
+            M_stop = true;
+        }
+        M_cond.notify_all();
+        M_thread.join();
+    }
+}
+
+AsyncStreamBuf::int_type
+AsyncStreamBuf::overflow( int_type c )
+{
+    collect();
+    if ( c != traits_type::eof() )
+    {
+        *pptr() = traits_type::to_char_type( c );
+        pbump( 1 );
+    }
+    return traits_type::not_eof( c );
+}
+
+int
+AsyncStreamBuf::sync()
+{
+    collect();
+
+    if ( ! M_thread.joinable() )
+    {
+        M_target->write( M_front.data(), M_front.size() );
+        M_target->flush();
+        M_front.clear();
+        return M_target->good() ? 0 : -1;
+    }
+
+    bool failed;
+    {
+        std::unique_lock< std::mutex > lock( M_mutex );
+        M_cond.wait( lock, [this] { return ! M_busy; } );
+        M_front.swap( M_back );
+        M_busy = true;
+        failed = M_failed;
+    }
+    M_cond.notify_all();
+
+    return failed ? -1 : 0;
+}
+
+void
+AsyncStreamBuf::collect()
+{
+    M_front.insert( M_front.end(), pbase(), pptr() );
+    setp( M_outbuf.data(), M_outbuf.data() + M_outbuf.size() );
+}
+
+void
+AsyncStreamBuf::run()
+{
+    blockTerminationSignals();
+
+    std::unique_lock< std::mutex > lock( M_mutex );
+
+    for ( ; ; )
+    {
+        M_cond.wait( lock, [this] { return M_busy || M_stop; } );
+        if ( ! M_busy )
+        {
+            break;
+        }
+
+        lock.unlock();
+        M_target->write( M_back.data(), M_back.size() );
+        M_target->flush();
+        const bool failed = ! M_target->good();
+        M_back.clear();
+        lock.lock();
+
+        M_failed = M_failed || failed;
+        M_busy = false;
+        M_cond.notify_all();
+    }
+}
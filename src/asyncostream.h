@@ -0,0 +1,104 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                asyncostream.h
+                  Output stream written by a background thread
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_ASYNCOSTREAM_H
+#define RCSSSERVER_ASYNCOSTREAM_H
+
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+  \class AsyncStreamBuf
+  \brief stream buffer that collects its output in memory and has it
+  written to another stream by a separate thread.
+
+  Every sync() hands the data collected so far to the thread, which
+  writes and flushes the target stream, e.g. a compressed log file.
+  sync() only waits for the thread if the data of the previous sync()
+  has not been written yet.
+ */
+class AsyncStreamBuf
+    : public std::streambuf {
+private:
+    std::unique_ptr< std::ostream > M_target;
+
+    std::vector< char > M_outbuf;
+    std::vector< char > M_front; //!< filled by the writing thread
+    std::vector< char > M_back; //!< written by the background thread
+
+    std::thread M_thread;
+    std::mutex M_mutex;
+    std::condition_variable M_cond;
+    bool M_busy;
+    bool M_stop;
+    bool M_failed; //!< the target stream went bad
+
+    AsyncStreamBuf( const AsyncStreamBuf & ) = delete;
+    AsyncStreamBuf & operator=( const AsyncStreamBuf & ) = delete;
+
+public:
+    //! takes the ownership of target
+    explicit
+    AsyncStreamBuf( std::ostream * target );
+
+    //! writes all data and destroys the target
+    ~AsyncStreamBuf();
+
+protected:
+
+    virtual
+    int_type overflow( int_type c = traits_type::eof() ) override;
+
+    virtual
+    int sync() override;
+
+private:
+    void collect();
+
+    void run();
+};
+
+
+/*!
+  \class AsyncOStream
+  \brief output stream over an AsyncStreamBuf.
+ */
+class AsyncOStream
+    : public std::ostream {
+private:
+    AsyncStreamBuf M_buf;
+
+public:
+    //! takes the ownership of target
+    explicit
+    AsyncOStream( std::ostream * target )
+        : std::ostream( nullptr ),
+          M_buf( target )
+      {
+          rdbuf( &M_buf );
+      }
+};
+
+#endif
@@ -38,8 +38,28 @@
 
 #include <rcss/factory.hpp>
 
+#include <sstream>
+
 namespace rcss {
 
+template < typename Serialize >
+void
+AudioSender::sendShared( const std::type_info & serializer,
+                         const int variant,
+                         Serialize serialize )
+{
+    const std::string * bytes = M_broadcast_cache.find( serializer, variant );
+    if ( ! bytes )
+    {
+        std::ostringstream strm;
+        serialize( strm );
+        bytes = &M_broadcast_cache.store( serializer, variant, strm.str() );
+    }
+
+    transport().write( bytes->data(), bytes->size() );
+    transport() << std::ends << std::flush;
+}
+
 void
 Listener::sendRefereeAudio( const char * msg )
 {
@@ -116,6 +136,7 @@ AudioSenderPlayer::factory()
 
 AudioSenderPlayer::AudioSenderPlayer( const Params & params )
     : AudioSender( params.M_stadium,
+                   params.M_broadcast_cache,
                    params.M_transport ),
       M_listener( params.M_listener ),
       M_serializer( params.M_serializer )
@@ -207,8 +228,11 @@ AudioSenderPlayerv1::sendRefereeAudio( const char * msg )
 {
     if ( generalPredicate () )
     {
-        serializer().serializeRefereeAudio( transport(), M_stadium.time(), msg );
-        transport() << std::ends << std::flush;
+        sendShared( typeid( serializer() ), 0,
+                    [&]( std::ostream & strm )
+                    {
+                        serializer().serializeRefereeAudio( strm, M_stadium.time(), msg );
+                    } );
     }
 }
 
@@ -266,23 +290,31 @@ AudioSenderPlayerv1::sendCoachStdAudio( const rcss::clang::Msg & msg )
             return;
         }
 
+        // the players that do not support the message get the
+        // second variant
         if ( msg.isSupported( listener().clangMinVer(),
                               listener().clangMaxVer() ) )
         {
-            serializer().serializeCoachStdAudio( transport(),
-                                                 msg.getTimeSend(),
-                                                 name,
-                                                 msg );
+            sendShared( typeid( serializer() ), 0,
+                        [&]( std::ostream & strm )
+                        {
+                            serializer().serializeCoachStdAudio( strm,
+                                                                 msg.getTimeSend(),
+                                                                 name,
+                                                                 msg );
+                        } );
         }
         else
         {
-            serializer().serializeCoachStdAudio( transport(),
-                                                 msg.getTimeSend(),
-                                                 name,
-                                                 rcss::clang::UnsuppMsg() );
+            sendShared( typeid( serializer() ), 1,
+                        [&]( std::ostream & strm )
+                        {
+                            serializer().serializeCoachStdAudio( strm,
+                                                                 msg.getTimeSend(),
+                                                                 name,
+                                                                 rcss::clang::UnsuppMsg() );
+                        } );
         }
-
-        transport() << std::ends << std::flush;
     }
 }
 
@@ -745,6 +777,7 @@ AudioSenderCoach::factory()
 
 AudioSenderCoach::AudioSenderCoach( const Params & params )
     : AudioSender( params.M_stadium,
+                   params.M_broadcast_cache,
                    params.M_transport ),
       M_listener( params.M_listener ),
       M_serializer( params.M_serializer )
@@ -773,8 +806,11 @@ AudioSenderCoachv1::sendRefereeAudio( const char * msg )
 {
     if ( generalPredicate() )
     {
-        serializer().serializeRefereeAudio( transport(), M_stadium.time(), msg );
-        transport() << std::ends << std::flush;
+        sendShared( typeid( serializer() ), 0,
+                    [&]( std::ostream & strm )
+                    {
+                        serializer().serializeRefereeAudio( strm, M_stadium.time(), msg );
+                    } );
     }
 }
 
@@ -829,11 +865,14 @@ AudioSenderCoachv1::sendCoachStdAudio( const rcss::clang::Msg & msg )
             // don't know what we have hear so don't send anything
             return;
         }
-        serializer().serializeCoachStdAudio( transport(),
-                                             M_stadium.time(),
-                                             name,
-                                             msg );
-        transport() << std::ends << std::flush;
+        sendShared( typeid( serializer() ), 0,
+                    [&]( std::ostream & strm )
+                    {
+                        serializer().serializeCoachStdAudio( strm,
+                                                             M_stadium.time(),
+                                                             name,
+                                                             msg );
+                    } );
     }
 }
 
@@ -876,6 +915,7 @@ AudioSenderOnlineCoach::factory()
 
 AudioSenderOnlineCoach::AudioSenderOnlineCoach( const Params & params )
     : AudioSender( params.M_stadium,
+                   params.M_broadcast_cache,
                    params.M_transport ),
       M_listener( params.M_listener ),
       M_serializer( params.M_serializer )
@@ -908,11 +948,14 @@ AudioSenderOnlineCoachv1::sendRefereeAudio( const char * msg )
 {
     if ( generalPredicate() )
     {
-        serializer().serializeRefereeAudio( transport(),
-                                            M_stadium.time(),
-                                            REFEREE_NAME,
-                                            msg );
-        transport() << std::ends << std::flush;
+        sendShared( typeid( serializer() ), 0,
+                    [&]( std::ostream & strm )
+                    {
+                        serializer().serializeRefereeAudio( strm,
+                                                            M_stadium.time(),
+                                                            REFEREE_NAME,
+                                                            msg );
+                    } );
     }
 }
 
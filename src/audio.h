@@ -33,6 +33,7 @@
 #include <string>
 #include <map>
 #include <list>
+#include <typeinfo>
 
 
 class Coach;
@@ -40,6 +41,7 @@ class OnlineCoach;
 class Player;
 class Stadium;
 class RemoteClient;
+class BroadcastCache;
 
 namespace rcss {
 
@@ -70,11 +72,14 @@ public:
 
 protected:
     const Stadium& M_stadium;
+    BroadcastCache & M_broadcast_cache;
 
     AudioSender( const Stadium & stadium,
+                 BroadcastCache & broadcast_cache,
                  std::ostream & transport )
         : Sender( transport )
         , M_stadium( stadium )
+        , M_broadcast_cache( broadcast_cache )
       { }
 
 public:
@@ -135,6 +140,19 @@ public:
     virtual
     void sendErrorNoTeamName( const std::string& )
       { }
+
+protected:
+    /*!
+      \brief send a message of a broadcast, serializing it only if no
+      other client with the same serializer class got it before
+      \param serializer the type of the serializer of the client
+      \param variant the variant of the message
+      \param serialize writes the message to a stream
+     */
+    template < typename Serialize >
+    void sendShared( const std::type_info & serializer,
+                     const int variant,
+                     Serialize serialize );
 };
 
 
@@ -220,15 +238,18 @@ public:
         Player & M_listener;
         const std::shared_ptr< SerializerPlayer > M_serializer;
         const Stadium & M_stadium;
+        BroadcastCache & M_broadcast_cache;
 
         Params( std::ostream & transport,
                 Player & listener,
                 const std::shared_ptr< SerializerPlayer > serializer,
-                const Stadium & stadium )
+                const Stadium & stadium,
+                BroadcastCache & broadcast_cache )
             : M_transport( transport ),
               M_listener( listener ),
               M_serializer( serializer ),
-              M_stadium( stadium )
+              M_stadium( stadium ),
+              M_broadcast_cache( broadcast_cache )
           { }
     };
 
@@ -555,15 +576,18 @@ public:
         Coach & M_listener;
         const std::shared_ptr< SerializerCoach > M_serializer;
         const Stadium & M_stadium;
+        BroadcastCache & M_broadcast_cache;
 
         Params( std::ostream & transport,
                 Coach & listener,
                 const std::shared_ptr< SerializerCoach > serializer,
-                const Stadium & stadium )
+                const Stadium & stadium,
+                BroadcastCache & broadcast_cache )
             : M_transport( transport ),
               M_listener( listener ),
               M_serializer( serializer ),
-              M_stadium( stadium )
+              M_stadium( stadium ),
+              M_broadcast_cache( broadcast_cache )
           { }
     };
 
@@ -663,15 +687,18 @@ public:
         OnlineCoach & M_listener;
         const std::shared_ptr< SerializerOnlineCoach > M_serializer;
         const Stadium & M_stadium;
+        BroadcastCache & M_broadcast_cache;
 
         Params( std::ostream & transport,
                 OnlineCoach & listener,
                 const std::shared_ptr< SerializerOnlineCoach > serializer,
-                const Stadium & stadium )
+                const Stadium & stadium,
+                BroadcastCache & broadcast_cache )
             : M_transport( transport ),
               M_listener( listener ),
               M_serializer( serializer ),
-              M_stadium( stadium )
+              M_stadium( stadium ),
+              M_broadcast_cache( broadcast_cache )
           { }
     };
 
@@ -0,0 +1,54 @@
+// -*-c++-*-
+
+/***************************************************************************
+                             broadcastcache.cpp
+              Serialized broadcast messages shared by the clients
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "broadcastcache.h"
+
+const std::string *
+BroadcastCache::find( const std::type_info & serializer,
+                      const int variant ) const
+{
+    // there are only as many entries as protocol versions in use
+    const std::type_index type( serializer );
+    for ( const Entry & e : M_entries )
+    {
+        if ( e.serializer_ == type
+             && e.variant_ == variant )
+        {
+            return &e.bytes_;
+        }
+    }
+
+    return nullptr;
+}
+
+const std::string &
+BroadcastCache::store( const std::type_info & serializer,
+                       const int variant,
+                       const std::string & bytes )
+{
+    Entry entry = { std::type_index( serializer ), variant, bytes };
+    M_entries.push_back( entry );
+    return M_entries.back().bytes_;
+}
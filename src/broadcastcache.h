@@ -0,0 +1,86 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              broadcastcache.h
+              Serialized broadcast messages shared by the clients
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_BROADCASTCACHE_H
+#define RCSSSERVER_BROADCASTCACHE_H
+
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+/*!
+  \class BroadcastCache
+  \brief the serialized variants of the message that is being
+  broadcast.
+
+  The referee audio and the standard coach audio go to every listener,
+  and each listener used to serialize the same message again.  A
+  serializer does not depend on its client, so all the clients whose
+  serializers are of the same class get the same bytes, unless the
+  sender chooses a different variant of the message, e.g. for a client
+  that does not support it.  The first sender of a variant serializes
+  it and stores the bytes, and the others only write them.
+
+  Stadium owns the cache and clears it before each broadcast.  The
+  audio senders are given it when they are created, and fill it while
+  the broadcast runs.
+ */
+class BroadcastCache {
+private:
+    struct Entry {
+        std::type_index serializer_;
+        int variant_;
+        std::string bytes_;
+    };
+
+    std::vector< Entry > M_entries;
+
+public:
+
+    //! forget the messages of the previous broadcast
+    void clear()
+      {
+          M_entries.clear();
+      }
+
+    /*!
+      \brief find a variant of the current message
+      \param serializer the type of the serializer of the client
+      \param variant the variant of the message
+      \return the bytes, or nullptr if the variant is not stored yet
+     */
+    const std::string * find( const std::type_info & serializer,
+                              const int variant ) const;
+
+    /*!
+      \brief store a variant of the current message
+      \param serializer the type of the serializer that made it
+      \param variant the variant of the message
+      \param bytes the serialized message
+      \return the stored bytes
+     */
+    const std::string & store( const std::type_info & serializer,
+                               const int variant,
+                               const std::string & bytes );
+};
+
+#endif
@@ -0,0 +1,99 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               broadphase.cpp
+             Sweep and prune search for possibly colliding objects
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "broadphase.h"
+
+#include "object.h"
+
+#include <algorithm>
+
+namespace {
+
+//! widening of the extents in meters, far above any rounding error
+const double MARGIN = 1.0e-6;
+
+}
+
+void
+Broadphase::findPairs( const std::vector< const MPObject * > & objects,
+                       std::vector< Pair > & pairs )
+{
+    pairs.clear();
+
+    const std::size_t n = objects.size();
+    if ( M_order.size() != n )
+    {
+        M_order.resize( n );
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            M_order[i] = i;
+        }
+    }
+
+    M_lower.resize( n );
+    M_upper.resize( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        const double x = objects[i]->pos().x;
+        const double r = objects[i]->size() + MARGIN;
+        M_lower[i] = x - r;
+        M_upper[i] = x + r;
+    }
+
+    //
+    // repair the order from the last call
+    //
+    for ( std::size_t k = 1; k < n; ++k )
+    {
+        const std::size_t i = M_order[k];
+        const double lower = M_lower[i];
+        std::size_t l = k;
+        while ( l > 0
+                && M_lower[M_order[l - 1]] > lower )
+        {
+            M_order[l] = M_order[l - 1];
+            --l;
+        }
+        M_order[l] = i;
+    }
+
+    //
+    // sweep
+    //
+    for ( std::size_t k = 0; k < n; ++k )
+    {
+        const std::size_t i = M_order[k];
+        const double upper = M_upper[i];
+        for ( std::size_t l = k + 1;
+              l < n && M_lower[M_order[l]] <= upper;
+              ++l )
+        {
+            const std::size_t j = M_order[l];
+            pairs.push_back( i < j ? Pair( i, j ) : Pair( j, i ) );
+        }
+    }
+
+    std::sort( pairs.begin(), pairs.end() );
+}
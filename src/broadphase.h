@@ -0,0 +1,67 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                broadphase.h
+             Sweep and prune search for possibly colliding objects
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_BROADPHASE_H
+#define RCSSSERVER_BROADPHASE_H
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+class MPObject;
+
+/*!
+  \class Broadphase
+  \brief finds the pairs of movable objects whose circles may overlap.
+
+  The objects are kept sorted by the lower end of their extent along
+  the x axis, and a sweep over that order pairs every object with the
+  ones whose extent starts before its own ends.  Between two calls the
+  objects move only a little, so the order is repaired by an insertion
+  sort, which is linear when nothing has swapped places.  The work is
+  proportional to the number of objects plus the number of overlaps
+  along the x axis, instead of the number of all pairs.
+
+  The extents are widened by a small margin, so every pair whose
+  circles overlap is reported; the caller still has to test each pair.
+ */
+class Broadphase {
+public:
+    typedef std::pair< std::size_t, std::size_t > Pair;
+
+private:
+    std::vector< std::size_t > M_order;
+    std::vector< double > M_lower;
+    std::vector< double > M_upper;
+
+public:
+
+    /*!
+      \brief find the candidate pairs at the current positions
+      \param objects the objects, their indices are used in the pairs
+      \param pairs the candidates, each as ( lower index, higher index ),
+      sorted in increasing order
+     */
+    void findPairs( const std::vector< const MPObject * > & objects,
+                    std::vector< Pair > & pairs );
+};
+
+#endif
@@ -0,0 +1,212 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               bufferwriter.h
+             Formatting of message tokens into a local buffer
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_BUFFERWRITER_H
+#define RCSSSERVER_BUFFERWRITER_H
+
+#include <ostream>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cstddef>
+
+namespace rcss {
+
+/*!
+  \class BufferWriter
+  \brief formats a message token into a local buffer and writes it to
+  a stream at once.
+
+  Every operator<< on a std::ostream constructs a sentry and goes
+  through the locale facets and the virtual functions of the stream
+  buffer.  A BufferWriter formats the values itself and hands the
+  whole token to the stream with a single write() when it is
+  destroyed, so a token is written as
+
+    BufferWriter( strm ) << " (" << name << ' ' << dist << ')';
+
+  The output is the same as that of the stream in the "C" locale:
+  integers in decimal, and doubles as printf's "%g" with the precision
+  of the stream, which is what a std::ostream without floatfield flags
+  does.  serializertest.cpp compares the output of the serializers of
+  every protocol version with that of the former operator<< code, and
+  serializerbench.cpp measures the difference in speed.
+ */
+class BufferWriter {
+private:
+    //! larger than any single token, a longer one is written in parts
+    static const std::size_t SIZE = 256;
+
+    std::ostream & M_strm;
+    const int M_precision;
+    std::size_t M_size;
+    char M_buf[SIZE];
+
+    // not used
+    BufferWriter( const BufferWriter & ) = delete;
+    BufferWriter & operator=( const BufferWriter & ) = delete;
+
+    //! make room for n more characters
+    void reserve( const std::size_t n )
+      {
+          if ( M_size + n > SIZE )
+          {
+              flush();
+          }
+      }
+
+    void append( const char * str,
+                 const std::size_t n )
+      {
+          if ( n > SIZE )
+          {
+              flush();
+              M_strm.write( str, n );
+              return;
+          }
+          reserve( n );
+          std::memcpy( M_buf + M_size, str, n );
+          M_size += n;
+      }
+
+    template < typename U >
+    void appendUnsigned( U value )
+      {
+          char digits[24];
+          char * p = digits + sizeof( digits );
+          do
+          {
+              *--p = static_cast< char >( '0' + value % 10 );
+              value /= 10;
+          }
+          while ( value != 0 );
+          append( p, digits + sizeof( digits ) - p );
+      }
+
+    template < typename S, typename U >
+    void appendSigned( const S value )
+      {
+          if ( value < 0 )
+          {
+              reserve( 1 );
+              M_buf[M_size++] = '-';
+              // negate in the unsigned type, which also works for the minimum
+              appendUnsigned( static_cast< U >( 0 ) - static_cast< U >( value ) );
+          }
+          else
+          {
+              appendUnsigned( static_cast< U >( value ) );
+          }
+      }
+
+public:
+
+    explicit
+    BufferWriter( std::ostream & strm )
+        : M_strm( strm ),
+          M_precision( static_cast< int >( strm.precision() ) ),
+          M_size( 0 )
+      { }
+
+    ~BufferWriter()
+      {
+          flush();
+      }
+
+    void flush()
+      {
+          if ( M_size > 0 )
+          {
+              M_strm.write( M_buf, M_size );
+              M_size = 0;
+          }
+      }
+
+    BufferWriter & operator<<( const char c )
+      {
+          reserve( 1 );
+          M_buf[M_size++] = c;
+          return *this;
+      }
+
+    BufferWriter & operator<<( const char * str )
+      {
+          append( str, std::strlen( str ) );
+          return *this;
+      }
+
+    BufferWriter & operator<<( const std::string & str )
+      {
+          append( str.data(), str.size() );
+          return *this;
+      }
+
+    BufferWriter & operator<<( const int value )
+      {
+          appendSigned< int, unsigned int >( value );
+          return *this;
+      }
+
+    BufferWriter & operator<<( const unsigned int value )
+      {
+          appendUnsigned( value );
+          return *this;
+      }
+
+    BufferWriter & operator<<( const long value )
+      {
+          appendSigned< long, unsigned long >( value );
+          return *this;
+      }
+
+    BufferWriter & operator<<( const unsigned long value )
+      {
+          appendUnsigned( value );
+          return *this;
+      }
+
+    BufferWriter & operator<<( const double & value )
+      {
+          // "%.*g" of a double never needs more than 32 characters
+          // for the precisions used here
+          reserve( 32 );
+          const int n = std::snprintf( M_buf + M_size, SIZE - M_size,
+                                       "%.*g", M_precision, value );
+          if ( n > 0 )
+          {
+              if ( static_cast< std::size_t >( n ) < SIZE - M_size )
+              {
+                  M_size += n;
+              }
+              else
+              {
+                  // too long for the buffer, let the stream do it
+                  flush();
+                  M_strm << value;
+              }
+          }
+          return *this;
+      }
+};
+
+}
+
+#endif
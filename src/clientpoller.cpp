@@ -0,0 +1,200 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               clientpoller.cpp
+                  Readiness set of dedicated client sockets
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "clientpoller.h"
+
+#include "networkingest.h"
+#include "remoteclient.h"
+
+#include <algorithm>
+#include <iostream>
+#include <cerrno>
+#include <cstring>
+
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+ClientPoller::ClientPoller()
+    : M_epoll_fd( -1 ),
+      M_ingest( nullptr ),
+      M_events_size( 0 ),
+      M_changes( 0 )
+{
+#ifdef HAVE_SYS_EPOLL_H
+    M_epoll_fd = ::epoll_create1( EPOLL_CLOEXEC );
+    if ( M_epoll_fd < 0 )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error creating epoll instance: "
+                  << std::strerror( errno ) << std::endl;
+    }
+#endif
+}
+
+ClientPoller::~ClientPoller()
+{
+#ifdef HAVE_SYS_EPOLL_H
+    if ( M_epoll_fd >= 0 )
+    {
+        ::close( M_epoll_fd );
+    }
+#endif
+}
+
+void
+ClientPoller::add( RemoteClient * client )
+{
+    remove( client );
+
+    M_clients.push_back( client );
+    ++M_changes;
+
+    if ( M_ingest
+         && ! client->usesSharedMemory() )
+    {
+        M_ingest->add( client );
+    }
+
+    if ( client->usesQueuedInput() )
+    {
+        M_queued_clients.push_back( client );
+        return;
+    }
+
+#ifdef HAVE_SYS_EPOLL_H
+    if ( M_epoll_fd >= 0 )
+    {
+        epoll_event ev;
+        ev.events = EPOLLIN | EPOLLPRI;
+        ev.data.ptr = client;
+        if ( ::epoll_ctl( M_epoll_fd, EPOLL_CTL_ADD, client->getFD(), &ev ) < 0 )
+        {
+            std::cerr << __FILE__ << ": " << __LINE__
+                      << ": Error registering client socket: "
+                      << std::strerror( errno ) << std::endl;
+        }
+    }
+#endif
+}
+
+void
+ClientPoller::remove( const RemoteClient * client )
+{
+    std::vector< RemoteClient * >::iterator it = std::find( M_clients.begin(),
+                                                            M_clients.end(),
+                                                            client );
+    if ( it == M_clients.end() )
+    {
+        return;
+    }
+
+    M_clients.erase( it );
+    ++M_changes;
+
+    if ( M_ingest )
+    {
+        M_ingest->remove( client );
+    }
+
+    it = std::find( M_queued_clients.begin(), M_queued_clients.end(), client );
+    if ( it != M_queued_clients.end() )
+    {
+        M_queued_clients.erase( it );
+        return;
+    }
+
+#ifdef HAVE_SYS_EPOLL_H
+    // a closed socket has already been dropped from the epoll set by
+    // the kernel, so errors are expected here and ignored.
+    if ( M_epoll_fd >= 0
+         && client->getFD() >= 0 )
+    {
+        epoll_event ev;
+        ::epoll_ctl( M_epoll_fd, EPOLL_CTL_DEL, client->getFD(), &ev );
+    }
+#endif
+}
+
+bool
+ClientPoller::hasSharedMemoryClients() const
+{
+    return std::any_of( M_queued_clients.begin(), M_queued_clients.end(),
+                        []( const RemoteClient * c )
+                        {
+                            return c->usesSharedMemory();
+                        } );
+}
+
+std::vector< RemoteClient * > &
+ClientPoller::readyClients()
+{
+    M_ready.clear();
+
+#ifdef HAVE_SYS_EPOLL_H
+    if ( M_epoll_fd >= 0 )
+    {
+        for ( RemoteClient * c : M_queued_clients )
+        {
+            if ( c->hasQueuedInput() )
+            {
+                M_ready.push_back( c );
+            }
+        }
+
+        if ( M_clients.size() == M_queued_clients.size() )
+        {
+            return M_ready;
+        }
+
+        // the buffer only grows, so the poll in the receive loop
+        // does not allocate
+        if ( M_events_size < M_clients.size() )
+        {
+            M_events_size = M_clients.size();
+            M_events.reset( new epoll_event[M_events_size] );
+        }
+
+        int n;
+        do
+        {
+            n = ::epoll_wait( M_epoll_fd, M_events.get(), M_events_size, 0 );
+        }
+        while ( n < 0 && errno == EINTR );
+
+        for ( int i = 0; i < n; ++i )
+        {
+            M_ready.push_back( static_cast< RemoteClient * >( M_events[i].data.ptr ) );
+        }
+        return M_ready;
+    }
+#endif
+
+    M_ready = M_clients;
+    return M_ready;
+}
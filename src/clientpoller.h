@@ -0,0 +1,104 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               clientpoller.h
+                  Readiness set of dedicated client sockets
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_CLIENTPOLLER_H
+#define RCSSSERVER_CLIENTPOLLER_H
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+class RemoteClient;
+class NetworkIngest;
+struct epoll_event;
+
+/*!
+  \class ClientPoller
+  \brief set of remote clients whose dedicated sockets are watched for input.
+
+  Where epoll is available, readyClients() only returns the clients
+  that have data waiting, so idle clients cost no system call.  On other
+  platforms every registered client is reported as ready.
+
+  Clients that use shared memory, or whose sockets are read by a
+  NetworkIngest thread, are not watched by epoll.  Their queues are
+  checked directly instead.
+ */
+class ClientPoller {
+private:
+    int M_epoll_fd;
+    NetworkIngest * M_ingest;
+
+    std::vector< RemoteClient * > M_clients; //!< registered clients
+    std::vector< RemoteClient * > M_queued_clients; //!< registered clients with queued input
+    std::vector< RemoteClient * > M_ready; //!< result of the last query
+    std::unique_ptr< epoll_event[] > M_events; //!< kept between the queries
+    std::size_t M_events_size;
+    unsigned long M_changes; //!< number of add() and remove() calls
+
+    ClientPoller( const ClientPoller & ) = delete;
+    ClientPoller & operator=( const ClientPoller & ) = delete;
+
+public:
+    ClientPoller();
+    ~ClientPoller();
+
+    //! hand the sockets of clients added later to ingest instead of epoll
+    void setIngest( NetworkIngest * ingest )
+      {
+          M_ingest = ingest;
+      }
+
+    //! start watching the current socket of client
+    void add( RemoteClient * client );
+
+    //! stop watching client
+    void remove( const RemoteClient * client );
+
+    /*!
+      \brief the descriptor that becomes readable when any registered
+      client is readable, or -1 if there is no such descriptor.
+     */
+    int getFD() const
+      {
+          return M_epoll_fd;
+      }
+
+    const
+    std::vector< RemoteClient * > & clients() const
+      {
+          return M_clients;
+      }
+
+    //! changes every time a client is added or removed
+    unsigned long changes() const
+      {
+          return M_changes;
+      }
+
+    //! true if some input can arrive without waking up getFD()
+    bool hasSharedMemoryClients() const;
+
+    //! non-blocking query of the clients with pending input
+    std::vector< RemoteClient * > & readyClients();
+};
+
+#endif
@@ -158,7 +158,8 @@ Coach::setSenders( const double & client_version )
     rcss::AudioSenderCoach::Params audio_params( getTransport(),
                                                  *this,
                                                  ser,
-                                                 M_stadium );
+                                                 M_stadium,
+                                                 M_stadium.broadcastCache() );
 
     rcss::AudioSenderCoach::Creator audio_cre;
     if( ! rcss::AudioSenderCoach::factory().getCreator( audio_cre,
@@ -173,7 +174,8 @@ Coach::setSenders( const double & client_version )
     rcss::InitSenderOfflineCoach::Params init_params( getTransport(),
                                                       *this,
                                                       ser,
-                                                      M_stadium );
+                                                      M_stadium,
+                                                      M_stadium.initPayloadCache() );
     rcss::InitSenderOfflineCoach::Creator init_cre;
     if ( ! rcss::InitSenderOfflineCoach::factory().getCreator( init_cre,
                                                                (int)client_version ) )
@@ -509,7 +511,7 @@ Coach::parse_move( const char * command )
                           PLAYER_NAME_FORMAT,
                           teamname, &unum ) != 2
              || unum < 1
-             || MAX_PLAYER < unum )
+             || ServerParam::instance().teamSize() < unum )
         {
             send( "(error illegal_object_form)" );
             return 0;
@@ -601,6 +603,7 @@ Coach::compression( int level )
         return;
     }
 
+    setInputCompressionLevel( level );
 
     std::ostringstream reply;
     reply << "(ok compression " << level << ")";
@@ -1037,7 +1040,8 @@ OnlineCoach::setSenders( const double & client_version )
     rcss::AudioSenderOnlineCoach::Params audio_params( getTransport(),
                                                        *this,
                                                        ser,
-                                                       M_stadium );
+                                                       M_stadium,
+                                                       M_stadium.broadcastCache() );
     rcss::AudioSenderOnlineCoach::Creator audio_cre;
     if ( ! rcss::AudioSenderOnlineCoach::factory().getCreator( audio_cre,
                                                                (int)client_version ) )
@@ -1051,7 +1055,8 @@ OnlineCoach::setSenders( const double & client_version )
     rcss::InitSenderOnlineCoach::Params init_params( getTransport(),
                                                      *this,
                                                      ser,
-                                                     M_stadium );
+                                                     M_stadium,
+                                                     M_stadium.initPayloadCache() );
     rcss::InitSenderOnlineCoach::Creator init_cre;
     if ( ! rcss::InitSenderOnlineCoach::factory().getCreator( init_cre,
                                                               (int)client_version ) )
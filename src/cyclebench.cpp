@@ -0,0 +1,272 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               cyclebench.cpp
+                  Cycle time benchmark for a configurable team size
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+/*
+ * Runs the simulator loop without waiting between the events, with
+ * server::team_size players on each side connected over the loopback
+ * interface, and reports the time the server spends in each cycle.
+ * The arguments are server parameters, e.g.
+ *
+ *   rcsscyclebench server::team_size=25
+ *
+ * Each player sends a dash or a turn every cycle.  The time the
+ * players take to send and to receive is not counted.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "stadium.h"
+#include "serverparam.h"
+
+#include <rcss/net/addr.hpp>
+#include <rcss/net/udpsocket.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <locale>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+
+namespace {
+
+const int CONNECT_TRIES = 1000;
+const int WARMUP_CYCLES = 20;
+const int MEASURE_CYCLES = 300;
+
+/*!
+  \class BenchPlayer
+  \brief a player that only sends fixed commands and discards what it
+  receives.
+ */
+class BenchPlayer {
+private:
+    rcss::net::UDPSocket M_socket;
+    rcss::net::Addr M_server;
+    bool M_connected;
+
+public:
+    BenchPlayer()
+        : M_socket(),
+          M_server(),
+          M_connected( false )
+      { }
+
+    bool open( const rcss::net::Addr & server,
+               const std::string & teamname )
+      {
+          if ( ! M_socket.open()
+               || M_socket.setNonBlocking() < 0
+               || ! M_socket.bind( rcss::net::Addr() ) )
+          {
+              std::cerr << __FILE__ << ": " << __LINE__
+                        << ": Error opening socket: "
+                        << strerror( errno ) << std::endl;
+              return false;
+          }
+
+          M_server = server;
+          const std::string msg = "(init " + teamname + " (version 17))";
+          return M_socket.send( msg.c_str(), msg.length() + 1, M_server ) > 0;
+      }
+
+    bool connected() const
+      {
+          return M_connected;
+      }
+
+    //! discard every waiting message.  the reply to init tells the port
+    void receive()
+      {
+          char buf[8192];
+          rcss::net::Addr from;
+          while ( M_socket.recv( buf, sizeof( buf ), from ) > 0 )
+          {
+              if ( ! M_connected
+                   && ! std::strncmp( buf, "(init ", std::strlen( "(init " ) ) )
+              {
+                  M_server = from;
+                  M_connected = true;
+              }
+          }
+      }
+
+    void send( const char * msg )
+      {
+          M_socket.send( msg, std::strlen( msg ) + 1, M_server );
+      }
+};
+
+
+void
+runCycle( Stadium & stadium,
+          double & visual_time )
+{
+    const ServerParam & param = ServerParam::instance();
+
+    stadium.recvFromClients();
+    stadium.newSimulatorStep();
+    stadium.sendSenseBody();
+
+    // the standard timer sends the visuals at a quarter of send_step
+    visual_time -= param.simStep();
+    while ( visual_time <= 0.0 )
+    {
+        stadium.sendVisuals();
+        visual_time += param.sendStep() * 0.25;
+    }
+
+    stadium.sendCoachMessages();
+}
+
+}
+
+int
+main( int argc, char *argv[] )
+{
+    std::locale::global( std::locale::classic() );
+
+    //
+    // fixed settings first, so that the arguments can override them
+    //
+    std::vector< const char * > args;
+    args.push_back( argv[0] );
+    args.push_back( "server::text_logging=false" );
+    args.push_back( "server::game_logging=false" );
+    args.push_back( "server::auto_mode=true" );
+    args.push_back( "server::kick_off_wait=1" );
+    args.push_back( "server::connect_wait=1000" );
+    args.push_back( "server::synch_mode=false" );
+    args.push_back( "server::port=16000" );
+    args.push_back( "server::coach_port=16001" );
+    args.push_back( "server::olcoach_port=16002" );
+    args.insert( args.end(), argv + 1, argv + argc );
+
+    if ( ! ServerParam::init( static_cast< int >( args.size() ),
+                              const_cast< char ** >( args.data() ) ) )
+    {
+        return 1;
+    }
+
+    const int team_size = ServerParam::instance().teamSize();
+    double mean_msec = 0.0;
+    double max_msec = 0.0;
+    bool ok = false;
+
+    {
+        Stadium stadium;
+        if ( ! stadium.init() )
+        {
+            ServerParam::instance().clear();
+            return 1;
+        }
+
+        rcss::net::Addr server( ServerParam::instance().playerPort() );
+        server.setHost( "127.0.0.1" );
+
+        std::vector< std::unique_ptr< BenchPlayer > > players;
+        for ( int i = 0; i < team_size * 2; ++i )
+        {
+            players.emplace_back( new BenchPlayer() );
+            if ( ! players.back()->open( server, i < team_size ? "BenchLeft" : "BenchRight" ) )
+            {
+                ServerParam::instance().clear();
+                return 1;
+            }
+        }
+
+        //
+        // connect everybody before the match starts
+        //
+        int connected = 0;
+        for ( int t = 0; t < CONNECT_TRIES && connected < team_size * 2; ++t )
+        {
+            stadium.recvFromClients();
+            connected = 0;
+            for ( std::unique_ptr< BenchPlayer > & p : players )
+            {
+                p->receive();
+                connected += p->connected() ? 1 : 0;
+            }
+        }
+
+        if ( connected < team_size * 2 )
+        {
+            std::cerr << "only " << connected << " of " << team_size * 2
+                      << " players could connect" << std::endl;
+        }
+        else
+        {
+            double visual_time = 0.0;
+            std::chrono::steady_clock::duration total( 0 );
+            std::chrono::steady_clock::duration longest( 0 );
+
+            for ( int c = 0; c < WARMUP_CYCLES + MEASURE_CYCLES; ++c )
+            {
+                for ( std::unique_ptr< BenchPlayer > & p : players )
+                {
+                    p->send( c % 4 == 0 ? "(turn 40)" : "(dash 80)" );
+                }
+
+                const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                runCycle( stadium, visual_time );
+                const std::chrono::steady_clock::duration d = std::chrono::steady_clock::now() - start;
+
+                if ( c >= WARMUP_CYCLES )
+                {
+                    total += d;
+                    longest = std::max( longest, d );
+                }
+
+                for ( std::unique_ptr< BenchPlayer > & p : players )
+                {
+                    p->receive();
+                }
+            }
+
+            typedef std::chrono::duration< double, std::milli > Msec;
+            mean_msec = std::chrono::duration_cast< Msec >( total ).count() / MEASURE_CYCLES;
+            max_msec = std::chrono::duration_cast< Msec >( longest ).count();
+            ok = true;
+        }
+    }
+
+    ServerParam::instance().clear();
+
+    if ( ! ok )
+    {
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision( 3 )
+              << "team_size " << team_size
+              << ": " << MEASURE_CYCLES << " cycles"
+              << ", mean " << mean_msec << " ms"
+              << ", max " << max_msec << " ms" << std::endl;
+
+    return 0;
+}
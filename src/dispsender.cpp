@@ -195,9 +195,15 @@ DispSenderMonitorV1::sendShow()
     // players
     //
 
-    const Stadium::PlayerCont & players = stadium().players();
+    const std::vector< const Player * > & players = stadium().binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &dinfo.body.show.pos[i+1], 0, sizeof( dinfo.body.show.pos[i+1] ) );
+            continue;
+        }
+
         dinfo.body.show.pos[i+1].enable = htons( players[i]->state() );
         dinfo.body.show.pos[i+1].x = htons( (Int16)rint( players[i]->pos().x * SHOWINFO_SCALE ) );
         dinfo.body.show.pos[i+1].y = htons( (Int16)rint( players[i]->pos().y * SHOWINFO_SCALE ) );
@@ -358,9 +364,15 @@ DispSenderMonitorV2::sendShow()
     // players
     //
 
-    const Stadium::PlayerCont & players = stadium().players();
+    const std::vector< const Player * > & players = stadium().binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &dinfo.body.show.pos[i], 0, sizeof( dinfo.body.show.pos[i] ) );
+            continue;
+        }
+
         dinfo.body.show.pos[i].mode = htons( players[i]->state() );
         dinfo.body.show.pos[i].type = htons( players[i]->playerTypeId() );
 
@@ -698,9 +710,15 @@ DispSenderLoggerV1::sendShow()
     disp.body.show.pos[0].x = htons( (Int16)rint( ( stadium().ball().pos().x * SHOWINFO_SCALE ) ) );
     disp.body.show.pos[0].y = htons( (Int16)rint( ( stadium().ball().pos().y * SHOWINFO_SCALE ) ) );
 
-    const Stadium::PlayerCont & players = stadium().players();
+    const std::vector< const Player * > & players = stadium().binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &disp.body.show.pos[i+1], 0, sizeof( disp.body.show.pos[i+1] ) );
+            continue;
+        }
+
         disp.body.show.pos[i+1].enable = htons( players[i]->state() );
         disp.body.show.pos[i+1].x = htons( (Int16)rint( players[i]->pos().x * SHOWINFO_SCALE ) );
         disp.body.show.pos[i+1].y = htons( (Int16)rint( players[i]->pos().y * SHOWINFO_SCALE ) );
@@ -817,9 +835,15 @@ DispSenderLoggerV2::sendShow()
     show.pos[0].x = htons( (Int16)rint( ( stadium().ball().pos().x * SHOWINFO_SCALE ) ) );
     show.pos[0].y = htons( (Int16)rint( ( stadium().ball().pos().y * SHOWINFO_SCALE ) ) );
 
-    const Stadium::PlayerCont & players = stadium().players();
+    const std::vector< const Player * > & players = stadium().binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &show.pos[i+1], 0, sizeof( show.pos[i+1] ) );
+            continue;
+        }
+
         show.pos[i+1].enable = htons( players[i]->state() );
         show.pos[i+1].x = htons( (Int16)rint( players[i]->pos().x * SHOWINFO_SCALE ) );
         show.pos[i+1].y = htons( (Int16)rint( players[i]->pos().y * SHOWINFO_SCALE ) );
@@ -932,9 +956,15 @@ DispSenderLoggerV3::sendShow()
     show.ball.deltax = htonl( (Int32)rint( ( stadium().ball().vel().x * SHOWINFO_SCALE2 ) ) );
     show.ball.deltay = htonl( (Int32)rint( ( stadium().ball().vel().y * SHOWINFO_SCALE2) ) );
 
-    const Stadium::PlayerCont & players = stadium().players();
+    const std::vector< const Player * > & players = stadium().binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &show.pos[i], 0, sizeof( show.pos[i] ) );
+            continue;
+        }
+
         show.pos[i].mode = htons( players[i]->state() );
         show.pos[i].type = htons( players[i]->playerTypeId() );
 
@@ -0,0 +1,126 @@
+// -*-c++-*-
+
+/***************************************************************************
+                             distancetable.cpp
+            Shared distances and directions between movable objects
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "distancetable.h"
+
+#include "object.h"
+#include "player.h"
+
+DistanceTable::DistanceTable()
+    : M_team_size( 0 )
+{
+
+}
+
+void
+DistanceTable::assign( const std::vector< Player * > & players,
+                       const MPObject * ball )
+{
+    M_objects.assign( players.begin(), players.end() );
+    M_objects.push_back( ball );
+    M_team_size = players.size() / 2;
+
+    const std::size_t n = M_objects.size();
+    M_moves.resize( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        M_moves[i] = M_objects[i]->moves();
+    }
+    M_dist2.assign( n * n, 0.0 );
+    M_dist2_valid.assign( n * n, 0 );
+    M_ball_dir.assign( n, 0.0 );
+    M_ball_dir_valid.assign( n, 0 );
+}
+
+std::size_t
+DistanceTable::index( const Player & player ) const
+{
+    return ( player.side() == LEFT ? 0 : M_team_size ) + player.unum() - 1;
+}
+
+void
+DistanceTable::check( const std::size_t i ) const
+{
+    const unsigned long moves = M_objects[i]->moves();
+    if ( M_moves[i] == moves )
+    {
+        return;
+    }
+
+    M_moves[i] = moves;
+
+    const std::size_t n = M_objects.size();
+    for ( std::size_t j = 0; j < n; ++j )
+    {
+        M_dist2_valid[i * n + j] = 0;
+        M_dist2_valid[j * n + i] = 0;
+    }
+
+    if ( i == ballIndex() )
+    {
+        M_ball_dir_valid.assign( n, 0 );
+    }
+    else
+    {
+        M_ball_dir_valid[i] = 0;
+    }
+}
+
+double
+DistanceTable::dist2( const std::size_t a,
+                      const std::size_t b ) const
+{
+    check( a );
+    check( b );
+
+    const std::size_t n = M_objects.size();
+    if ( ! M_dist2_valid[a * n + b] )
+    {
+        // ( a - b ).r2() and ( b - a ).r2() are the same
+        const double d2 = M_objects[a]->pos().distance2( M_objects[b]->pos() );
+        M_dist2[a * n + b] = d2;
+        M_dist2[b * n + a] = d2;
+        M_dist2_valid[a * n + b] = 1;
+        M_dist2_valid[b * n + a] = 1;
+    }
+
+    return M_dist2[a * n + b];
+}
+
+double
+DistanceTable::ballDir( const Player & from ) const
+{
+    const std::size_t i = index( from );
+    check( i );
+    check( ballIndex() );
+
+    if ( ! M_ball_dir_valid[i] )
+    {
+        M_ball_dir[i] = ( M_objects[ballIndex()]->pos() - M_objects[i]->pos() ).th();
+        M_ball_dir_valid[i] = 1;
+    }
+
+    return M_ball_dir[i];
+}
@@ -0,0 +1,112 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              distancetable.h
+            Shared distances and directions between movable objects
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_DISTANCETABLE_H
+#define RCSSSERVER_DISTANCETABLE_H
+
+#include <vector>
+#include <cstddef>
+
+class MPObject;
+class Player;
+
+/*!
+  \class DistanceTable
+  \brief squared distances between the players and the ball, and the
+  directions from every object to the ball, shared by everything that
+  looks at them during a cycle.
+
+  The players have the indices of their slots in Stadium::players(),
+  and the ball comes last.  The entries are computed when they are
+  first looked up and kept until one of their objects moves.  Every
+  query compares MPObject::moves() of the objects it uses with the
+  value seen before, and a moved object only invalidates its own row
+  and column, or every direction if it is the ball.
+
+  The values are computed with the same expressions as
+  PVector::distance2 and PVector::th, so they are bit-identical to
+  computing them in place.
+ */
+class DistanceTable {
+private:
+    std::vector< const MPObject * > M_objects;
+    std::size_t M_team_size;
+
+    //! MPObject::moves() of each object when its entries were checked
+    mutable std::vector< unsigned long > M_moves;
+    mutable std::vector< double > M_dist2;
+    mutable std::vector< char > M_dist2_valid;
+    mutable std::vector< double > M_ball_dir; //!< from each object to the ball
+    mutable std::vector< char > M_ball_dir_valid;
+
+public:
+    DistanceTable();
+
+    /*!
+      \brief set the objects
+      \param players the player slots, left team first
+      \param ball the ball
+     */
+    void assign( const std::vector< Player * > & players,
+                 const MPObject * ball );
+
+    std::size_t size() const
+      {
+          return M_objects.size();
+      }
+
+    //! the index of a player
+    std::size_t index( const Player & player ) const;
+
+    //! the index of the ball
+    std::size_t ballIndex() const
+      {
+          return M_objects.size() - 1;
+      }
+
+    //! the squared distance between two objects
+    double dist2( const std::size_t a,
+                  const std::size_t b ) const;
+
+    double dist2( const Player & a,
+                  const Player & b ) const
+      {
+          return dist2( index( a ), index( b ) );
+      }
+
+    double ballDist2( const Player & player ) const
+      {
+          return dist2( index( player ), ballIndex() );
+      }
+
+    /*!
+      \brief the global direction from a player to the ball
+      \return the same value as ( ball.pos() - from.pos() ).th()
+     */
+    double ballDir( const Player & from ) const;
+
+private:
+
+    //! invalidate the entries of an object if it has moved
+    void check( const std::size_t i ) const;
+};
+
+#endif
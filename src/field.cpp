@@ -50,13 +50,14 @@
  *===================================================================
  */
 Field::Field()
-    : line_l( LINE_L_NAME, LINE_L_NAME_SHORT, "(Line)", "(L)",
+    : M_object_count( 0 ),
+      line_l( newObjectId(), LINE_L_NAME, LINE_L_NAME_SHORT, "(Line)", "(L)",
               PVector( - ServerParam::PITCH_LENGTH / 2.0, 0.0 ) ),
-      line_r( LINE_R_NAME, LINE_R_NAME_SHORT, "(Line)", "(L)",
+      line_r( newObjectId(), LINE_R_NAME, LINE_R_NAME_SHORT, "(Line)", "(L)",
               PVector( + ServerParam::PITCH_LENGTH / 2.0, 0.0 ) ),
-      line_t( LINE_T_NAME, LINE_T_NAME_SHORT, "(Line)", "(L)",
+      line_t( newObjectId(), LINE_T_NAME, LINE_T_NAME_SHORT, "(Line)", "(L)",
               PVector( - ServerParam::PITCH_WIDTH / 2.0, 0.0 ) ),
-      line_b( LINE_B_NAME, LINE_B_NAME_SHORT, "(Line)", "(L)",
+      line_b( newObjectId(), LINE_B_NAME, LINE_B_NAME_SHORT, "(Line)", "(L)",
               PVector( + ServerParam::PITCH_WIDTH / 2.0, 0.0 ) )
 
 {
@@ -89,3 +90,29 @@ Field::addLandmark( PObject * new_obj )
         M_landmarks.push_back( new_obj );
     }
 }
+
+void
+Field::indexLandmarks()
+{
+    M_landmark_index.build( M_landmarks );
+}
+
+void
+Field::landmarksInView( const PVector & pos,
+                        const double & face,
+                        const double & half_angle,
+                        const double & close_dist,
+                        std::vector< std::size_t > & result ) const
+{
+    if ( M_landmark_index.size() != M_landmarks.size() )
+    {
+        result.resize( M_landmarks.size() );
+        for ( std::size_t i = 0; i < result.size(); ++i )
+        {
+            result[i] = i;
+        }
+        return;
+    }
+
+    M_landmark_index.query( pos, face, half_angle, close_dist, result );
+}
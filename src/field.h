@@ -44,6 +44,7 @@
 
 #include "object.h"
 #include "weather.h"
+#include "landmarkindex.h"
 
 #include <rcss/gzip/gzfstream.hpp>
 #include <rcss/net/udpsocket.hpp>
@@ -79,8 +80,10 @@ class Field {
 private:
     const Field & operator=( const Field & );
 
+    int M_object_count; //!< the objects of the match created so far
     std::vector< const PObject * > M_goals;
     std::vector< PObject * > M_landmarks;
+    LandmarkIndex M_landmark_index;
 public:
     const PObject line_l;
     const PObject line_r;
@@ -90,6 +93,12 @@ public:
     Field();
     ~Field();
 
+    //! the id of a new object of the match, the lines, landmarks or movable objects
+    int newObjectId()
+      {
+          return M_object_count++;
+      }
+
     const
     std::vector< const PObject * > & goals() const
       {
@@ -103,6 +112,19 @@ public:
       }
 
     void addLandmark( PObject * new_obj );
+
+    //! build the view cone index, once all landmarks have been added
+    void indexLandmarks();
+
+    /*!
+      \brief the indices of the landmarks that may be seen by a player,
+      in increasing order.  all landmarks if they have not been indexed.
+     */
+    void landmarksInView( const PVector & pos,
+                          const double & face,
+                          const double & half_angle,
+                          const double & close_dist,
+                          std::vector< std::size_t > & result ) const;
 };
 
 #endif
@@ -0,0 +1,60 @@
+// -*-c++-*-
+
+/***************************************************************************
+                            initpayloadcache.cpp
+                Serialized parameter messages of the init protocol
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "initpayloadcache.h"
+
+const InitPayloadCache::Messages *
+InitPayloadCache::find( const std::type_info & serializer,
+                        const unsigned int version,
+                        const bool game_log,
+                        const Payload payload ) const
+{
+    // there are only a few kinds of clients in a match
+    const std::type_index type( serializer );
+    for ( const Entry & e : M_entries )
+    {
+        if ( e.serializer_ == type
+             && e.version_ == version
+             && e.game_log_ == game_log
+             && e.payload_ == payload )
+        {
+            return &e.messages_;
+        }
+    }
+
+    return nullptr;
+}
+
+const InitPayloadCache::Messages &
+InitPayloadCache::store( const std::type_info & serializer,
+                         const unsigned int version,
+                         const bool game_log,
+                         const Payload payload,
+                         const Messages & messages )
+{
+    Entry entry = { std::type_index( serializer ), version, game_log, payload, messages };
+    M_entries.push_back( entry );
+    return M_entries.back().messages_;
+}
@@ -0,0 +1,101 @@
+// -*-c++-*-
+
+/***************************************************************************
+                             initpayloadcache.h
+                Serialized parameter messages of the init protocol
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_INITPAYLOADCACHE_H
+#define RCSSSERVER_INITPAYLOADCACHE_H
+
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+/*!
+  \class InitPayloadCache
+  \brief the server_param, player_param and player_type messages sent
+  to the connecting clients.
+
+  The messages depend only on the parameters, the player types, the
+  class of the serializer of the client, the protocol version and
+  whether they go to a game log.  The first client of a kind builds
+  them, and the clients of the same kind that connect later only
+  write the stored bytes.  Each message is kept with its terminator,
+  and the sender flushes after each one, so that every message is
+  still a message of its own.
+
+  The parameters are read before Stadium is created, and Stadium
+  creates the player types in init() before it opens its sockets, so
+  nothing that is cached can change while the cache exists.  The game
+  log is written once per match and does not use the cache.
+ */
+class InitPayloadCache {
+public:
+    enum Payload {
+        SERVER_PARAMS,
+        PLAYER_PARAMS,
+        PLAYER_TYPES,
+    };
+
+    //! the messages of a payload, each with its terminator
+    typedef std::vector< std::string > Messages;
+
+private:
+    struct Entry {
+        std::type_index serializer_;
+        unsigned int version_;
+        bool game_log_;
+        Payload payload_;
+        Messages messages_;
+    };
+
+    std::vector< Entry > M_entries;
+
+public:
+
+    /*!
+      \brief find a payload
+      \param serializer the type of the serializer of the client
+      \param version the protocol version of the client
+      \param game_log true if the payload goes to a game log
+      \param payload the payload
+      \return the messages, or nullptr if the payload is not stored yet
+     */
+    const Messages * find( const std::type_info & serializer,
+                           const unsigned int version,
+                           const bool game_log,
+                           const Payload payload ) const;
+
+    /*!
+      \brief store a payload
+      \param serializer the type of the serializer that built it
+      \param version the protocol version it was built for
+      \param game_log true if it was built for a game log
+      \param payload the payload
+      \param messages the serialized messages
+      \return the stored messages
+     */
+    const Messages & store( const std::type_info & serializer,
+                            const unsigned int version,
+                            const bool game_log,
+                            const Payload payload,
+                            const Messages & messages );
+};
+
+#endif
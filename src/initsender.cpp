@@ -31,6 +31,8 @@
 #include "playerparam.h"
 #include "heteroplayer.h"
 
+#include <sstream>
+
 namespace rcss {
 
 /*
@@ -55,6 +57,51 @@ InitSender::~InitSender()
 }
 
 
+/*
+//===================================================================
+//
+//  CLASS: InitSenderCommon
+//
+//===================================================================
+*/
+
+template < typename Build >
+void
+InitSenderCommon::sendPayload( const InitPayloadCache::Payload payload,
+                               Build build )
+{
+    const InitPayloadCache::Messages * messages = nullptr;
+    if ( M_payload_cache )
+    {
+        messages = M_payload_cache->find( typeid( serializer() ),
+                                          version(),
+                                          isGameLog(),
+                                          payload );
+    }
+
+    InitPayloadCache::Messages built;
+    if ( ! messages )
+    {
+        build( built );
+        messages = &built;
+        if ( M_payload_cache )
+        {
+            messages = &M_payload_cache->store( typeid( serializer() ),
+                                                version(),
+                                                isGameLog(),
+                                                payload,
+                                                built );
+        }
+    }
+
+    for ( const std::string & msg : *messages )
+    {
+        transport().write( msg.data(), msg.size() );
+        transport() << std::flush;
+    }
+}
+
+
 /*
 //===================================================================
 //
@@ -66,350 +113,369 @@ InitSender::~InitSender()
 void
 InitSenderCommonV7::sendServerParams()
 {
-    serializer().serializeServerParamBegin( transport() );
-    serializer().serializeParam( transport(),
+    sendPayload( InitPayloadCache::SERVER_PARAMS,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializeServerParams( messages );
+                 } );
+}
+
+void
+InitSenderCommonV7::serializeServerParams( InitPayloadCache::Messages & messages )
+{
+    std::ostringstream strm;
+
+    serializer().serializeServerParamBegin( strm );
+    serializer().serializeParam( strm,
                                  ServerParam::instance().goalWidth() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().inertiaMoment() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerSize() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerDecay() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerRand() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerWeight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerSpeedMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerAccelMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().staminaMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().staminaInc() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().recoverInit() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().recoverDecThr() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().recoverMin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().recoverDec() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().effortInit() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().effortDecThr() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().effortMin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().effortDec() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().effortIncThr() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().effortInc() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().kickRand() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().teamActuatorNoise() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerRandFactorLeft() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().playerRandFactorRight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().kickRandFactorLeft() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().kickRandFactorRight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().ballSize() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().ballDecay() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().ballRand() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().ballWeight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().ballSpeedMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().ballAccelMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().dashPowerRate() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().kickPowerRate() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().kickableMargin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().controlRadius() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().controlRadiusWidth() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().maxPower() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().minPower() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().maxMoment() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().minMoment() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().maxNeckMoment() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().minNeckMoment() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().maxNeckAngle() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().minNeckAngle() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().visibleAngleDegree() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().visibleDistance() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().windDir() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().windForce() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().windAngle() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().windRand() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().kickableArea() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().catchAreaLength() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().catchAreaWidth() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().catchProbability() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().goalieMaxMoves() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().cornerKickMargin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().offsideActiveArea() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().windNone() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().windRandom() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().freeformCountMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().freeformMsgSize() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().clangWinSize() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().clangDefineWin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().clangMetaWin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().clangAdviceWin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().clangInfoWin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().clangMessDelay() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().clangMessPerCycle() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().halfTime() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().simStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().sendStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().recvStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().senseBodyStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().lcmStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().sayMsgSize() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().hearMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().hearInc() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().hearDecay() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().catchBanCycle() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().slowDownFactor() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().useOffside() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().kickOffOffside() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().offsideKickMargin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().audioCutDist() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().quantizeStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().landmarkQuantizeStep() );
 #ifdef NEW_QSTEP
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().dirQStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().distQStepLeft() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().distQStepRight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().landQStepLeft() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().landQStepRight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().dirQStepLeft() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().dirQStepRight() );
 #else
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  -1 );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  -1 );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  -1 );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  -1 );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  -1 );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  -1 );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  -1 );
 #endif
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().coachMode() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().coachWithRefereeMode() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().coachOldHear() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().coachVisualStep() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().startGoalLeft() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().startGoalRight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().fullstateLeft() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().fullstateRight() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  ServerParam::instance().dropTime() );
-    serializer().serializeServerParamEnd( transport() );
-    if ( isGameLog() )
-    {
-        transport() << std::endl;
-    }
-    else
-    {
-        transport() << std::ends << std::flush;
-    }
+    serializer().serializeServerParamEnd( strm );
+    strm << ( isGameLog() ? '\n' : '\0' );
+    messages.push_back( strm.str() );
 }
 
 void
 InitSenderCommonV7::sendPlayerParams()
 {
-    serializer().serializePlayerParamBegin( transport() );
-    serializer().serializeParam( transport(),
+    sendPayload( InitPayloadCache::PLAYER_PARAMS,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializePlayerParams( messages );
+                 } );
+}
+
+void
+InitSenderCommonV7::serializePlayerParams( InitPayloadCache::Messages & messages )
+{
+    std::ostringstream strm;
+
+    serializer().serializePlayerParamBegin( strm );
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().playerTypes() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().subsMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().ptMax() );
 
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().playerSpeedMaxDeltaMin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().playerSpeedMaxDeltaMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().staminaIncMaxDeltaFactor() );
 
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().playerDecayDeltaMin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().playerDecayDeltaMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().inertiaMomentDeltaFactor() );
 
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().dashPowerRateDeltaMin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().dashPowerRateDeltaMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().playerSizeDeltaFactor() );
 
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().kickableMarginDeltaMin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().kickableMarginDeltaMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().kickRandDeltaFactor() );
 
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().extraStaminaDeltaMin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().extraStaminaDeltaMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().effortMaxDeltaFactor() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  PlayerParam::instance().effortMinDeltaFactor() );
-    serializer().serializePlayerParamEnd( transport() );
-    if ( isGameLog() )
-    {
-        transport() << std::endl;
-    }
-    else
-    {
-        transport() << std::ends << std::flush;
-    }
+    serializer().serializePlayerParamEnd( strm );
+    strm << ( isGameLog() ? '\n' : '\0' );
+    messages.push_back( strm.str() );
 }
 
 void
 InitSenderCommonV7::sendPlayerTypes()
+{
+    sendPayload( InitPayloadCache::PLAYER_TYPES,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializePlayerTypes( messages );
+                 } );
+}
+
+void
+InitSenderCommonV7::serializePlayerTypes( InitPayloadCache::Messages & messages )
 {
     for ( int i = 0; i < PlayerParam::instance().playerTypes(); ++i )
     {
         const HeteroPlayer * type = stadium().playerType( i );
         if ( type )
         {
-            serializer().serializePlayerTypeBegin( transport(), i );
+            std::ostringstream strm;
 
-            serializePlayerType( *type );
+            serializer().serializePlayerTypeBegin( strm, i );
 
-            serializer().serializePlayerTypeEnd( transport() );
-            if ( isGameLog() )
-            {
-                transport() << std::endl;
-            }
-            else
-            {
-                transport() << std::ends << std::flush;
-            }
+            serializePlayerType( strm, *type );
+
+            serializer().serializePlayerTypeEnd( strm );
+            strm << ( isGameLog() ? '\n' : '\0' );
+            messages.push_back( strm.str() );
         }
     }
 }
 
 void
-InitSenderCommonV7::serializePlayerType( const HeteroPlayer & type )
+InitSenderCommonV7::serializePlayerType( std::ostream & strm,
+                                         const HeteroPlayer & type )
 {
     // serializer().serializeParam( transport(),
     //                              id );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.playerSpeedMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.staminaIncMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.playerDecay() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.inertiaMoment() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.dashPowerRate() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.playerSize() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.kickableMargin() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.kickRand() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.extraStamina() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.effortMax() );
-    serializer().serializeParam( transport(),
+    serializer().serializeParam( strm,
                                  type.effortMin() );
 }
 
@@ -418,10 +484,22 @@ InitSenderCommonV7::serializePlayerType( const HeteroPlayer & type )
 void
 InitSenderCommonV8::sendServerParams()
 {
-    serializer().serializeServerParamBegin( transport() );
+    sendPayload( InitPayloadCache::SERVER_PARAMS,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializeServerParams( messages );
+                 } );
+}
+
+void
+InitSenderCommonV8::serializeServerParams( InitPayloadCache::Messages & messages )
+{
+    std::ostringstream strm;
+
+    serializer().serializeServerParamBegin( strm );
     for ( ServerParam::VerMap::const_reference param : ServerParam::instance().verMap() )
     {
-        sendServerParam( param );
+        serializeServerParam( strm, param );
     }
     // std::for_each( ServerParam::instance().verMap().begin(),
     //                ServerParam::instance().verMap().end(),
@@ -431,19 +509,14 @@ InitSenderCommonV8::sendServerParams()
     //                } );
     //                // std::bind1st( std::mem_fun( &rcss::InitSenderCommonV8::sendServerParam ),
     //                //               this ) );
-    serializer().serializeServerParamEnd( transport() );
-    if ( isGameLog() )
-    {
-        transport() << std::endl;
-    }
-    else
-    {
-        transport() << std::ends << std::flush;
-    }
+    serializer().serializeServerParamEnd( strm );
+    strm << ( isGameLog() ? '\n' : '\0' );
+    messages.push_back( strm.str() );
 }
 
 void
-InitSenderCommonV8::sendServerParam( const ServerParam::VerMap::value_type & param )
+InitSenderCommonV8::serializeServerParam( std::ostream & strm,
+                                          const ServerParam::VerMap::value_type & param )
 {
     if ( param.second <= version() )
     {
@@ -451,7 +524,7 @@ InitSenderCommonV8::sendServerParam( const ServerParam::VerMap::value_type & par
         int ivalue;
         if ( ServerParam::instance().getInt( param.first, ivalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          ivalue );
             return;
@@ -460,7 +533,7 @@ InitSenderCommonV8::sendServerParam( const ServerParam::VerMap::value_type & par
         bool bvalue;
         if ( ServerParam::instance().getBool( param.first, bvalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          bvalue );
             return;
@@ -469,7 +542,7 @@ InitSenderCommonV8::sendServerParam( const ServerParam::VerMap::value_type & par
         double dvalue;
         if ( ServerParam::instance().getDouble( param.first, dvalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          dvalue );
             return;
@@ -478,7 +551,7 @@ InitSenderCommonV8::sendServerParam( const ServerParam::VerMap::value_type & par
         std::string svalue;
         if ( ServerParam::instance().getStr( param.first, svalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          svalue );
             return;
@@ -489,10 +562,22 @@ InitSenderCommonV8::sendServerParam( const ServerParam::VerMap::value_type & par
 void
 InitSenderCommonV8::sendPlayerParams()
 {
-    serializer().serializePlayerParamBegin( transport() );
+    sendPayload( InitPayloadCache::PLAYER_PARAMS,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializePlayerParams( messages );
+                 } );
+}
+
+void
+InitSenderCommonV8::serializePlayerParams( InitPayloadCache::Messages & messages )
+{
+    std::ostringstream strm;
+
+    serializer().serializePlayerParamBegin( strm );
     for ( PlayerParam::VerMap::const_reference param : PlayerParam::instance().verMap() )
     {
-        sendPlayerParam( param );
+        serializePlayerParam( strm, param );
     }
     // std::for_each( PlayerParam::instance().verMap().begin(),
     //                PlayerParam::instance().verMap().end(),
@@ -502,27 +587,22 @@ InitSenderCommonV8::sendPlayerParams()
     //                } );
     //                // std::bind1st( std::mem_fun( &rcss::InitSenderCommonV8::sendPlayerParam ),
     //                //               this ) );
-    serializer().serializePlayerParamEnd( transport() );
-    if ( isGameLog() )
-    {
-        transport() << std::endl;
-    }
-    else
-    {
-        transport() << std::ends << std::flush;
-    }
+    serializer().serializePlayerParamEnd( strm );
+    strm << ( isGameLog() ? '\n' : '\0' );
+    messages.push_back( strm.str() );
 }
 
 
 void
-InitSenderCommonV8::sendPlayerParam( const PlayerParam::VerMap::value_type & param )
+InitSenderCommonV8::serializePlayerParam( std::ostream & strm,
+                                          const PlayerParam::VerMap::value_type & param )
 {
     if ( param.second <= version() )
     {
         int ivalue;
         if ( PlayerParam::instance().getInt( param.first, ivalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          ivalue );
             return;
@@ -531,7 +611,7 @@ InitSenderCommonV8::sendPlayerParam( const PlayerParam::VerMap::value_type & par
         bool bvalue;
         if ( PlayerParam::instance().getBool( param.first, bvalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          bvalue );
             return;
@@ -540,7 +620,7 @@ InitSenderCommonV8::sendPlayerParam( const PlayerParam::VerMap::value_type & par
         double dvalue;
         if ( PlayerParam::instance().getDouble( param.first, dvalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          dvalue );
             return;
@@ -549,7 +629,7 @@ InitSenderCommonV8::sendPlayerParam( const PlayerParam::VerMap::value_type & par
         std::string svalue;
         if ( PlayerParam::instance().getStr( param.first, svalue ) )
         {
-            serializer().serializeParam( transport(),
+            serializer().serializeParam( strm,
                                          param.first,
                                          svalue );
             return;
@@ -559,25 +639,31 @@ InitSenderCommonV8::sendPlayerParam( const PlayerParam::VerMap::value_type & par
 
 void
 InitSenderCommonV8::sendPlayerTypes()
+{
+    sendPayload( InitPayloadCache::PLAYER_TYPES,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializePlayerTypes( messages );
+                 } );
+}
+
+void
+InitSenderCommonV8::serializePlayerTypes( InitPayloadCache::Messages & messages )
 {
     for ( int i = 0; i < PlayerParam::instance().playerTypes(); ++i )
     {
         const HeteroPlayer * type = stadium().playerType( i );
         if ( type )
         {
-            serializer().serializePlayerTypeBegin( transport(), i );
+            std::ostringstream strm;
 
-            type->printParamsSExp( transport(), version() );
+            serializer().serializePlayerTypeBegin( strm, i );
 
-            serializer().serializePlayerTypeEnd( transport() );
-            if ( isGameLog() )
-            {
-                transport() << std::endl;
-            }
-            else
-            {
-                transport() << std::ends << std::flush;
-            }
+            type->printParamsSExp( strm, version() );
+
+            serializer().serializePlayerTypeEnd( strm );
+            strm << ( isGameLog() ? '\n' : '\0' );
+            messages.push_back( strm.str() );
         }
     }
 }
@@ -590,12 +676,24 @@ InitSenderCommonV8::sendPlayerTypes()
 void
 InitSenderCommonJSON::sendServerParams()
 {
+    sendPayload( InitPayloadCache::SERVER_PARAMS,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializeServerParams( messages );
+                 } );
+}
+
+void
+InitSenderCommonJSON::serializeServerParams( InitPayloadCache::Messages & messages )
+{
+    std::ostringstream strm;
+
     if ( isGameLog() )
     {
-        transport() << ",\n";
+        strm << ",\n";
     }
 
-    serializer().serializeServerParamBegin( transport() );
+    serializer().serializeServerParamBegin( strm );
     bool first = true;
     for ( ServerParam::VerMap::const_reference param : ServerParam::instance().verMap() )
     {
@@ -607,10 +705,10 @@ InitSenderCommonJSON::sendServerParams()
             }
             else
             {
-                transport() << ',';
+                strm << ',';
             }
 
-            sendServerParam( param );
+            serializeServerParam( strm, param );
         }
     }
     // std::for_each( ServerParam::instance().verMap().begin(),
@@ -627,35 +725,44 @@ InitSenderCommonJSON::sendServerParams()
     //                        sendServerParam( v );
     //                    }
     //                } );
-    serializer().serializeServerParamEnd( transport() );
+    serializer().serializeServerParamEnd( strm );
 
-    if ( isGameLog() )
+    if ( ! isGameLog() )
     {
-        transport() << std::flush;
-    }
-    else
-    {
-        transport() << std::ends << std::flush;
+        strm << '\0';
     }
+    messages.push_back( strm.str() );
 }
 
 void
 InitSenderCommonJSON::sendPlayerParams()
 {
+    sendPayload( InitPayloadCache::PLAYER_PARAMS,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializePlayerParams( messages );
+                 } );
+}
+
+void
+InitSenderCommonJSON::serializePlayerParams( InitPayloadCache::Messages & messages )
+{
+    std::ostringstream strm;
+
     if ( isGameLog() )
     {
-        transport() << ",\n";
+        strm << ",\n";
     }
 
-    serializer().serializePlayerParamBegin( transport() );
+    serializer().serializePlayerParamBegin( strm );
     bool first = true;
     for ( PlayerParam::VerMap::const_reference param : PlayerParam::instance().verMap() )
     {
         if ( param.second <= version() )
         {
-            if ( first ) first = false; else transport() << ',';
+            if ( first ) first = false; else strm << ',';
 
-            sendPlayerParam( param );
+            serializePlayerParam( strm, param );
         }
     }
     // std::for_each( PlayerParam::instance().verMap().begin(),
@@ -672,21 +779,28 @@ InitSenderCommonJSON::sendPlayerParams()
     //                        sendPlayerParam( v );
     //                    }
     //                } );
-    serializer().serializePlayerParamEnd( transport() );
+    serializer().serializePlayerParamEnd( strm );
 
-    if ( isGameLog() )
+    if ( ! isGameLog() )
     {
-        transport() << std::flush;
-    }
-    else
-    {
-        transport() << std::ends << std::flush;
+        strm << '\0';
     }
+    messages.push_back( strm.str() );
 }
 
 
 void
 InitSenderCommonJSON::sendPlayerTypes()
+{
+    sendPayload( InitPayloadCache::PLAYER_TYPES,
+                 [this]( InitPayloadCache::Messages & messages )
+                 {
+                     serializePlayerTypes( messages );
+                 } );
+}
+
+void
+InitSenderCommonJSON::serializePlayerTypes( InitPayloadCache::Messages & messages )
 {
     const int max_types = PlayerParam::instance().playerTypes();
     if ( max_types == 0 )
@@ -699,35 +813,35 @@ InitSenderCommonJSON::sendPlayerTypes()
         const HeteroPlayer * type = stadium().playerType( i );
         if ( type )
         {
+            std::ostringstream strm;
+
             if ( isGameLog() )
             {
-                transport() << ",\n";
+                strm << ",\n";
             }
 
-            serializer().serializePlayerTypeBegin( transport(), i );
+            serializer().serializePlayerTypeBegin( strm, i );
 
-            type->printParamsJSON( transport(), version() );
+            type->printParamsJSON( strm, version() );
 
-            serializer().serializePlayerTypeEnd( transport() );
-            if ( isGameLog() )
-            {
-                transport() << std::flush;
-            }
-            else
+            serializer().serializePlayerTypeEnd( strm );
+            if ( ! isGameLog() )
             {
-                transport() << std::ends << std::flush;
+                strm << '\0';
             }
+            messages.push_back( strm.str() );
         }
     }
 }
 
 void
-InitSenderCommonJSON::sendServerParam( ServerParam::VerMap::value_type param )
+InitSenderCommonJSON::serializeServerParam( std::ostream & strm,
+                                            ServerParam::VerMap::value_type param )
 {
     int ivalue;
     if ( ServerParam::instance().getInt( param.first, ivalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      ivalue );
         return;
@@ -736,7 +850,7 @@ InitSenderCommonJSON::sendServerParam( ServerParam::VerMap::value_type param )
     bool bvalue;
     if ( ServerParam::instance().getBool( param.first, bvalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      bvalue );
         return;
@@ -745,7 +859,7 @@ InitSenderCommonJSON::sendServerParam( ServerParam::VerMap::value_type param )
     double dvalue;
     if ( ServerParam::instance().getDouble( param.first, dvalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      dvalue );
         return;
@@ -754,7 +868,7 @@ InitSenderCommonJSON::sendServerParam( ServerParam::VerMap::value_type param )
     std::string svalue;
     if ( ServerParam::instance().getStr( param.first, svalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      svalue );
         return;
@@ -762,12 +876,13 @@ InitSenderCommonJSON::sendServerParam( ServerParam::VerMap::value_type param )
 }
 
 void
-InitSenderCommonJSON::sendPlayerParam( const PlayerParam::VerMap::value_type & param )
+InitSenderCommonJSON::serializePlayerParam( std::ostream & strm,
+                                            const PlayerParam::VerMap::value_type & param )
 {
     int ivalue;
     if ( PlayerParam::instance().getInt( param.first, ivalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      ivalue );
         return;
@@ -776,7 +891,7 @@ InitSenderCommonJSON::sendPlayerParam( const PlayerParam::VerMap::value_type & p
     bool bvalue;
     if ( PlayerParam::instance().getBool( param.first, bvalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      bvalue );
         return;
@@ -785,7 +900,7 @@ InitSenderCommonJSON::sendPlayerParam( const PlayerParam::VerMap::value_type & p
     double dvalue;
     if ( PlayerParam::instance().getDouble( param.first, dvalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      dvalue );
         return;
@@ -794,7 +909,7 @@ InitSenderCommonJSON::sendPlayerParam( const PlayerParam::VerMap::value_type & p
     std::string svalue;
     if ( PlayerParam::instance().getStr( param.first, svalue ) )
     {
-        serializer().serializeParam( transport(),
+        serializer().serializeParam( strm,
                                      param.first,
                                      svalue );
         return;
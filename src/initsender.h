@@ -25,6 +25,7 @@
 
 #include "sender.h"
 #include "observer.h"
+#include "initpayloadcache.h"
 #include "serverparam.h"
 #include "playerparam.h"
 
@@ -52,6 +53,8 @@ private:
     std::ostream & M_transport;
     const std::shared_ptr< Serializer > M_serializer;
     const Stadium & M_stadium;
+    //! the payloads shared with the other clients, or nullptr
+    InitPayloadCache * M_payload_cache;
     const unsigned int M_version;
     const bool M_game_log;
 
@@ -59,11 +62,13 @@ public:
     InitSenderCommon( std::ostream & transport,
                       const std::shared_ptr< Serializer > serializer,
                       const Stadium & stadium,
+                      InitPayloadCache * payload_cache,
                       unsigned int version,
                       const bool game_log = false )
         : M_transport( transport ),
           M_serializer( serializer ),
           M_stadium( stadium ),
+          M_payload_cache( payload_cache ),
           M_version( version ),
           M_game_log( game_log )
       { }
@@ -105,6 +110,19 @@ public:
 
     virtual
     void sendPlayerTypes() = 0;
+
+protected:
+    /*!
+      \brief send the messages of a payload.  With a payload cache,
+      they are built only if no client with the same serializer class,
+      version and log format got them before
+      \param payload the payload
+      \param build appends the messages of the payload, each with its
+      terminator, to its argument
+     */
+    template < typename Build >
+    void sendPayload( const InitPayloadCache::Payload payload,
+                      Build build );
 };
 
 /*!
@@ -182,11 +200,13 @@ public:
     InitSenderCommonV1( std::ostream & transport,
                         const std::shared_ptr< Serializer > serializer,
                         const Stadium & stad,
+                        InitPayloadCache * payload_cache,
                         unsigned int version,
                         const bool new_line = false )
         : InitSenderCommon( transport,
                             serializer,
                             stad,
+                            payload_cache,
                             version,
                             new_line )
       { }
@@ -225,11 +245,13 @@ public:
     InitSenderCommonV7( std::ostream & transport,
                         const std::shared_ptr< Serializer > serializer,
                         const Stadium & stad,
+                        InitPayloadCache * payload_cache,
                         unsigned int version,
                         const bool new_line = false )
         : InitSenderCommonV1( transport,
                               serializer,
                               stad,
+                              payload_cache,
                               version,
                               new_line )
       { }
@@ -249,8 +271,16 @@ public:
 
 protected:
     virtual
-    void serializePlayerType( const HeteroPlayer & type );
+    void serializePlayerType( std::ostream & strm,
+                              const HeteroPlayer & type );
+
+private:
+
+    void serializeServerParams( InitPayloadCache::Messages & messages );
 
+    void serializePlayerParams( InitPayloadCache::Messages & messages );
+
+    void serializePlayerTypes( InitPayloadCache::Messages & messages );
 };
 
 /*!
@@ -269,11 +299,13 @@ public:
     InitSenderCommonV8( std::ostream & transport,
                         const std::shared_ptr< Serializer > serializer,
                         const Stadium & stad,
+                        InitPayloadCache * payload_cache,
                         unsigned int version,
                         const bool new_line = false )
         : InitSenderCommonV7( transport,
                               serializer,
                               stad,
+                              payload_cache,
                               version,
                               new_line )
       { }
@@ -293,9 +325,17 @@ public:
 
 private:
 
-    void sendServerParam( const ServerParam::VerMap::value_type & param );
+    void serializeServerParams( InitPayloadCache::Messages & messages );
+
+    void serializePlayerParams( InitPayloadCache::Messages & messages );
+
+    void serializePlayerTypes( InitPayloadCache::Messages & messages );
 
-    void sendPlayerParam( const PlayerParam::VerMap::value_type & param );
+    void serializeServerParam( std::ostream & strm,
+                               const ServerParam::VerMap::value_type & param );
+
+    void serializePlayerParam( std::ostream & strm,
+                               const PlayerParam::VerMap::value_type & param );
 };
 
 
@@ -315,11 +355,13 @@ public:
     InitSenderCommonJSON( std::ostream & transport,
                           const std::shared_ptr< Serializer > serializer,
                           const Stadium & stad,
+                          InitPayloadCache * payload_cache,
                           unsigned int version,
                           const bool new_line = false )
         : InitSenderCommon( transport,
                             serializer,
                             stad,
+                            payload_cache,
                             version,
                             new_line )
     { }
@@ -340,8 +382,14 @@ public:
 
 protected:
 
-    void sendServerParam( ServerParam::VerMap::value_type param );
-    void sendPlayerParam( const PlayerParam::VerMap::value_type & param );
+    void serializeServerParams( InitPayloadCache::Messages & messages );
+    void serializePlayerParams( InitPayloadCache::Messages & messages );
+    void serializePlayerTypes( InitPayloadCache::Messages & messages );
+
+    void serializeServerParam( std::ostream & strm,
+                               ServerParam::VerMap::value_type param );
+    void serializePlayerParam( std::ostream & strm,
+                               const PlayerParam::VerMap::value_type & param );
 
 };
 
@@ -82,6 +82,7 @@ InitSenderOfflineCoachV1::InitSenderOfflineCoachV1( const Params & params )
                               ( new InitSenderCommonV1( params.M_transport,
                                                         params.M_serializer,
                                                         params.M_stadium,
+                                                        &params.M_init_payload_cache,
                                                         (unsigned int)params.M_self.version() ) ) )
 {
 
@@ -136,6 +137,7 @@ InitSenderOfflineCoachV7::InitSenderOfflineCoachV7( const Params & params )
                                 ( new InitSenderCommonV7( params.M_transport,
                                                           params.M_serializer,
                                                           params.M_stadium,
+                                                          &params.M_init_payload_cache,
                                                           (unsigned int)params.M_self.version() ) ) )
 {
 
@@ -170,6 +172,7 @@ InitSenderOfflineCoachV8::InitSenderOfflineCoachV8( const Params & params )
                                 ( new InitSenderCommonV8( params.M_transport,
                                                           params.M_serializer,
                                                           params.M_stadium,
+                                                          &params.M_init_payload_cache,
                                                           (unsigned int)params.M_self.version() ) ) )
 {
 
@@ -90,6 +90,7 @@ InitSenderLoggerV1::InitSenderLoggerV1( const Params & params )
                         ( new InitSenderCommonV1( params.M_transport,
                                                   params.M_serializer,
                                                   params.M_stadium,
+                                                  nullptr,
                                                   1 ) ) )
 {
 
@@ -164,6 +165,7 @@ InitSenderLoggerV2::InitSenderLoggerV2( const Params & params )
                           ( new InitSenderCommonV1( params.M_transport,
                                                     params.M_serializer,
                                                     params.M_stadium,
+                                                    nullptr,
                                                     1 ) ) )
 {
 
@@ -237,6 +239,7 @@ InitSenderLoggerV3::InitSenderLoggerV3( const Params & params )
                           ( new InitSenderCommonV1( params.M_transport,
                                                     params.M_serializer,
                                                     params.M_stadium,
+                                                    nullptr,
                                                     1 ) ) )
 {
 
@@ -359,6 +362,7 @@ InitSenderLoggerV4::InitSenderLoggerV4( const Params & params )
                           ( new InitSenderCommonV8( params.M_transport,
                                                     params.M_serializer,
                                                     params.M_stadium,
+                                                    nullptr,
                                                     999,  // accept all parameters
                                                     true ) ) ) // new line
 {
@@ -446,6 +450,7 @@ InitSenderLoggerV5::InitSenderLoggerV5( const Params & params )
                           ( new InitSenderCommonV8( params.M_transport,
                                                     params.M_serializer,
                                                     params.M_stadium,
+                                                    nullptr,
                                                     999,  // accept all parameters
                                                     true ) ) ) // new line
 {
@@ -485,6 +490,7 @@ InitSenderLoggerJSON::InitSenderLoggerJSON( const Params & params )
                         std::shared_ptr< InitSenderCommon >( new InitSenderCommonJSON( params.M_transport,
                                                                                        params.M_serializer,
                                                                                        params.M_stadium,
+                                                                                       nullptr,
                                                                                        999,  // accept all parameters
                                                                                        true ) ) ) // new line
 {
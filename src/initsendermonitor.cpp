@@ -85,6 +85,7 @@ InitSenderMonitorV1::InitSenderMonitorV1( const Params & params )
                          ( new InitSenderCommonV1( params.M_transport,
                                                    params.M_serializer,
                                                    params.M_stadium,
+                                                   &params.M_init_payload_cache,
                                                    1 ) ) )
 {
 
@@ -159,6 +160,7 @@ InitSenderMonitorV2::InitSenderMonitorV2( const Params & params )
                            ( new InitSenderCommonV1( params.M_transport,
                                                      params.M_serializer,
                                                      params.M_stadium,
+                                                     &params.M_init_payload_cache,
                                                      2 ) ) )
 {
 
@@ -235,6 +237,7 @@ InitSenderMonitorV3::InitSenderMonitorV3( const Params & params )
                            ( new InitSenderCommonV8( params.M_transport,
                                                      params.M_serializer,
                                                      params.M_stadium,
+                                                     &params.M_init_payload_cache,
                                                      999 ) ) )
 {
     // The version of the common sender has to be "8".
@@ -304,6 +307,7 @@ InitSenderMonitorJSON::InitSenderMonitorJSON( const Params & params )
                          std::shared_ptr< InitSenderCommon >( new InitSenderCommonJSON( params.M_transport,
                                                                                         params.M_serializer,
                                                                                         params.M_stadium,
+                                                                                        &params.M_init_payload_cache,
                                                                                         999 ) ) )
 {
     // The client version must be "999" in order to send all parameters.
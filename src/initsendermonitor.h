@@ -48,15 +48,18 @@ public:
         const Monitor & M_self;
         const std::shared_ptr< SerializerMonitor > M_serializer;
         const Stadium & M_stadium;
+        InitPayloadCache & M_init_payload_cache;
 
         Params( std::ostream & transport,
                 const Monitor & self,
                 const std::shared_ptr< SerializerMonitor > serializer,
-                const Stadium & stadium )
+                const Stadium & stadium,
+                InitPayloadCache & init_payload_cache )
             : M_transport( transport ),
               M_self( self ),
               M_serializer( serializer ),
-              M_stadium( stadium )
+              M_stadium( stadium ),
+              M_init_payload_cache( init_payload_cache )
           { }
     };
 
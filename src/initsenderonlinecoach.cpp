@@ -96,6 +96,7 @@ InitSenderOnlineCoachV1::InitSenderOnlineCoachV1( const Params & params )
                              ( new InitSenderCommonV1( params.M_transport,
                                                        params.M_serializer,
                                                        params.M_stadium,
+                                                       &params.M_init_payload_cache,
                                                        (unsigned int)params.M_self.version() ) ) )
 {}
 
@@ -182,6 +183,7 @@ InitSenderOnlineCoachV7::InitSenderOnlineCoachV7( const Params & params )
                                ( new InitSenderCommonV7( params.M_transport,
                                                          params.M_serializer,
                                                          params.M_stadium,
+                                                         &params.M_init_payload_cache,
                                                          (unsigned int)params.M_self.version() ) ) )
 {
 
@@ -240,6 +242,7 @@ InitSenderOnlineCoachV8::InitSenderOnlineCoachV8( const Params & params )
                                ( new InitSenderCommonV8( params.M_transport,
                                                          params.M_serializer,
                                                          params.M_stadium,
+                                                         &params.M_init_payload_cache,
                                                          (unsigned int)params.M_self.version() ) ) )
 {
 
@@ -86,6 +86,7 @@ InitSenderPlayerV1::InitSenderPlayerV1( const Params & params )
                         ( new InitSenderCommonV1( params.M_transport,
                                                   params.M_serializer,
                                                   params.M_stadium,
+                                                  &params.M_init_payload_cache,
                                                   (unsigned int)params.M_self.version() ) ) )
 {
 
@@ -173,6 +174,7 @@ InitSenderPlayerV7::InitSenderPlayerV7( const Params & params )
                           ( new InitSenderCommonV7( params.M_transport,
                                                     params.M_serializer,
                                                     params.M_stadium,
+                                                    &params.M_init_payload_cache,
                                                     (unsigned int)params.M_self.version() ) ) )
 {
 
@@ -230,6 +232,7 @@ InitSenderPlayerV8::InitSenderPlayerV8( const Params & params )
                           ( new InitSenderCommonV8( params.M_transport,
                                                     params.M_serializer,
                                                     params.M_stadium,
+                                                    &params.M_init_payload_cache,
                                                     (unsigned int)params.M_self.version() ) ) )
 {
 
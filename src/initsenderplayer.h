@@ -54,15 +54,18 @@ public:
         const Player & M_self;
         const std::shared_ptr< SerializerPlayer > M_serializer;
         const Stadium & M_stadium;
+        InitPayloadCache & M_init_payload_cache;
 
         Params( std::ostream & transport,
                 const Player & self,
                 const std::shared_ptr< SerializerPlayer > serializer,
-                const Stadium & stadium )
+                const Stadium & stadium,
+                InitPayloadCache & init_payload_cache )
             : M_transport( transport )
             , M_self( self )
             , M_serializer( serializer )
             , M_stadium( stadium )
+            , M_init_payload_cache( init_payload_cache )
           { }
     };
 
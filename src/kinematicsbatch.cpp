@@ -0,0 +1,171 @@
+// -*-c++-*-
+
+/***************************************************************************
+                            kinematicsbatch.cpp
+             Acceleration of all movable objects in a single pass
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "kinematicsbatch.h"
+
+#include "object.h"
+#include "random.h"
+#include "serverparam.h"
+#include "utility.h"
+#include "weather.h"
+
+#include <cmath>
+
+namespace {
+
+//! noise distance, noise direction, wind x and wind y
+const std::size_t RANDOMS_PER_OBJECT = 4;
+
+}
+
+KinematicsBatch::KinematicsBatch()
+    : M_step( 0 )
+{
+
+}
+
+void
+KinematicsBatch::accelerate( const std::vector< MPObject * > & objects,
+                             const Weather & weather )
+{
+    //
+    // gather
+    //
+    M_objects.clear();
+    M_vel_x.clear();
+    M_vel_y.clear();
+    M_accel_x.clear();
+    M_accel_y.clear();
+    M_max_accel.clear();
+    M_max_speed.clear();
+    M_randp.clear();
+    M_wind_weight.clear();
+
+    for ( MPObject * o : objects )
+    {
+        if ( ! o->isEnabled() )
+        {
+            continue;
+        }
+
+        M_objects.push_back( o );
+        M_vel_x.push_back( o->M_vel.x );
+        M_vel_y.push_back( o->M_vel.y );
+        M_accel_x.push_back( o->M_accel.x );
+        M_accel_y.push_back( o->M_accel.y );
+        M_max_accel.push_back( o->maxAccel() );
+        M_max_speed.push_back( o->maxSpeed() );
+        M_randp.push_back( o->M_randp );
+        M_wind_weight.push_back( o->M_weight * ServerParam::instance().windWeight() );
+    }
+
+    const std::size_t n = M_objects.size();
+
+    //
+    // random numbers
+    //
+    M_random.resize( n * RANDOMS_PER_OBJECT );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        CounterRNG rng = DefaultRNG::stream( DefaultRNG::MOVE_NOISE,
+                                             M_objects[i]->id(),
+                                             M_step );
+        rng.fill( M_random.data() + i * RANDOMS_PER_OBJECT, RANDOMS_PER_OBJECT );
+    }
+    ++M_step;
+
+    //
+    // accelerate.
+    // an object without acceleration keeps its velocity as it is,
+    // even when it is above the speed limit.
+    //
+    double * const vel_x = M_vel_x.data();
+    double * const vel_y = M_vel_y.data();
+    const double * const accel_x = M_accel_x.data();
+    const double * const accel_y = M_accel_y.data();
+    const double * const max_accel = M_max_accel.data();
+    const double * const max_speed = M_max_speed.data();
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        const bool pushed = ( accel_x[i] != 0.0 || accel_y[i] != 0.0 );
+
+        const double accel = std::sqrt( accel_x[i] * accel_x[i] + accel_y[i] * accel_y[i] );
+        const double accel_rate = ( accel > max_accel[i] ? max_accel[i] / accel : 1.0 );
+        const double vx = vel_x[i] + accel_x[i] * accel_rate;
+        const double vy = vel_y[i] + accel_y[i] * accel_rate;
+
+        const double speed = std::sqrt( vx * vx + vy * vy );
+        const double speed_rate = ( speed > max_speed[i] ? max_speed[i] / speed : 1.0 );
+
+        vel_x[i] = ( pushed ? vx * speed_rate : vel_x[i] );
+        vel_y[i] = ( pushed ? vy * speed_rate : vel_y[i] );
+    }
+
+    //
+    // noise, up to randp times the speed in a random direction
+    //
+    const double * const random = M_random.data();
+    const double * const randp = M_randp.data();
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        const double * const r = random + i * RANDOMS_PER_OBJECT;
+        const double speed = std::sqrt( vel_x[i] * vel_x[i] + vel_y[i] * vel_y[i] );
+        const double dist = r[0] * randp[i] * speed;
+        const double dir = ( r[1] * 2.0 - 1.0 ) * M_PI;
+        vel_x[i] += dist * std::cos( dir );
+        vel_y[i] += dist * std::sin( dir );
+    }
+
+    //
+    // wind
+    //
+    const double wind_rand = weather.windRand();
+    if ( wind_rand >= EPS )
+    {
+        const double wind_x = weather.windVector().x;
+        const double wind_y = weather.windVector().y;
+        const double * const wind_weight = M_wind_weight.data();
+
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            const double * const r = random + i * RANDOMS_PER_OBJECT;
+            const double speed = std::sqrt( vel_x[i] * vel_x[i] + vel_y[i] * vel_y[i] );
+            const double wx = speed * ( wind_x + ( r[2] * 2.0 - 1.0 ) * wind_rand ) / wind_weight[i];
+            const double wy = speed * ( wind_y + ( r[3] * 2.0 - 1.0 ) * wind_rand ) / wind_weight[i];
+            vel_x[i] += wx;
+            vel_y[i] += wy;
+        }
+    }
+
+    //
+    // scatter
+    //
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        M_objects[i]->M_vel.assign( vel_x[i], vel_y[i] );
+    }
+}
@@ -0,0 +1,74 @@
+// -*-c++-*-
+
+/***************************************************************************
+                             kinematicsbatch.h
+             Acceleration of all movable objects in a single pass
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_KINEMATICSBATCH_H
+#define RCSSSERVER_KINEMATICSBATCH_H
+
+#include <vector>
+#include <cstdint>
+
+class MPObject;
+class Weather;
+
+/*!
+  \class KinematicsBatch
+  \brief applies the accelerations, noise and wind to the movable objects.
+
+  The velocity, acceleration and limits of the enabled objects are
+  gathered into separate arrays, the accelerations are limited and
+  added to the velocities in one loop without branches, and the
+  velocities are written back.  The random numbers of the noise and
+  the wind are generated for all objects at once, each object from its
+  own counter based stream keyed by the simulator seed, its id and the
+  number of the step, so they do not depend on the order in which the
+  objects are processed.  What follows in MPObject::_inc() handles the
+  goal posts, and is still done object by object.
+ */
+class KinematicsBatch {
+private:
+    std::vector< MPObject * > M_objects; //!< the enabled objects
+    std::vector< double > M_vel_x;
+    std::vector< double > M_vel_y;
+    std::vector< double > M_accel_x;
+    std::vector< double > M_accel_y;
+    std::vector< double > M_max_accel;
+    std::vector< double > M_max_speed;
+    std::vector< double > M_randp;
+    std::vector< double > M_wind_weight; //!< the weight times the wind weight
+    std::vector< double > M_random; //!< RANDOMS_PER_OBJECT values of each object
+
+    std::uint64_t M_step; //!< number of the current step, part of the random streams
+
+public:
+
+    KinematicsBatch();
+
+    /*!
+      \brief add the acceleration, the noise and the wind to the
+      velocity of each enabled object
+      \param objects the movable objects
+      \param weather the current wind
+     */
+    void accelerate( const std::vector< MPObject * > & objects,
+                     const Weather & weather );
+};
+
+#endif
@@ -0,0 +1,206 @@
+// -*-c++-*-
+
+/***************************************************************************
+                             landmarkindex.cpp
+              Grid of the landmarks for culling them by view cone
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "landmarkindex.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+//! landmarks per cell the grid is sized for
+const std::size_t CELL_LOAD = 4;
+
+//! slack of the box tests in meters, far above any rounding error
+const double MARGIN = 1.0e-6;
+
+}
+
+LandmarkIndex::LandmarkIndex()
+    : M_size( 0 )
+{
+
+}
+
+void
+LandmarkIndex::build( const std::vector< PObject * > & landmarks )
+{
+    M_size = landmarks.size();
+    M_boxes.clear();
+    M_begin.clear();
+    M_items.clear();
+
+    if ( landmarks.empty() )
+    {
+        M_begin.push_back( 0 );
+        return;
+    }
+
+    double min_x = landmarks.front()->pos().x;
+    double min_y = landmarks.front()->pos().y;
+    double max_x = min_x;
+    double max_y = min_y;
+    for ( const PObject * o : landmarks )
+    {
+        min_x = std::min( min_x, o->pos().x );
+        min_y = std::min( min_y, o->pos().y );
+        max_x = std::max( max_x, o->pos().x );
+        max_y = std::max( max_y, o->pos().y );
+    }
+
+    const double width = std::max( max_x - min_x, 1.0 );
+    const double height = std::max( max_y - min_y, 1.0 );
+    const std::size_t target = std::max( landmarks.size() / CELL_LOAD,
+                                         static_cast< std::size_t >( 1 ) );
+    const double cell_size = std::sqrt( width * height / target );
+    const std::size_t cols = std::max( static_cast< std::size_t >( std::ceil( width / cell_size ) ),
+                                       static_cast< std::size_t >( 1 ) );
+    const std::size_t rows = std::max( static_cast< std::size_t >( std::ceil( height / cell_size ) ),
+                                       static_cast< std::size_t >( 1 ) );
+
+    //
+    // bucket the landmarks, keeping their order within each cell
+    //
+    std::vector< std::size_t > cell_of( landmarks.size() );
+    std::vector< std::size_t > count( cols * rows, 0 );
+    for ( std::size_t i = 0; i < landmarks.size(); ++i )
+    {
+        const PVector & p = landmarks[i]->pos();
+        const std::size_t cx = std::min( static_cast< std::size_t >( ( p.x - min_x ) / cell_size ),
+                                         cols - 1 );
+        const std::size_t cy = std::min( static_cast< std::size_t >( ( p.y - min_y ) / cell_size ),
+                                         rows - 1 );
+        cell_of[i] = cy * cols + cx;
+        ++count[cell_of[i]];
+    }
+
+    // only the non-empty cells are kept
+    std::vector< std::size_t > slot( cols * rows, 0 );
+    M_begin.push_back( 0 );
+    for ( std::size_t c = 0; c < count.size(); ++c )
+    {
+        if ( count[c] == 0 )
+        {
+            continue;
+        }
+        slot[c] = M_boxes.size();
+        Box box = { max_x, max_y, min_x, min_y };
+        M_boxes.push_back( box );
+        M_begin.push_back( M_begin.back() + count[c] );
+    }
+
+    std::vector< std::size_t > next( M_begin.begin(), M_begin.end() - 1 );
+    M_items.resize( landmarks.size() );
+    for ( std::size_t i = 0; i < landmarks.size(); ++i )
+    {
+        const std::size_t k = slot[cell_of[i]];
+        const PVector & p = landmarks[i]->pos();
+        Box & box = M_boxes[k];
+        box.min_x_ = std::min( box.min_x_, p.x );
+        box.min_y_ = std::min( box.min_y_, p.y );
+        box.max_x_ = std::max( box.max_x_, p.x );
+        box.max_y_ = std::max( box.max_y_, p.y );
+        M_items[next[k]++] = i;
+    }
+}
+
+void
+LandmarkIndex::query( const PVector & pos,
+                      const double & face,
+                      const double & half_angle,
+                      const double & close_dist,
+                      std::vector< std::size_t > & result ) const
+{
+    result.clear();
+
+    // a cone of 360 degrees or more sees everything, and the edge
+    // normals below would wrap around and exclude cells behind the viewer
+    if ( half_angle >= M_PI )
+    {
+        result.resize( M_size );
+        for ( std::size_t i = 0; i < M_size; ++i )
+        {
+            result[i] = i;
+        }
+        return;
+    }
+
+    //
+    // inward normals of the two edges of the view cone.
+    // up to 90 degrees each way the cone is the intersection of the
+    // two half planes, beyond that it is their union.
+    //
+    const double left = face + half_angle;
+    const double right = face - half_angle;
+    const double n1_x = std::sin( left );
+    const double n1_y = -std::cos( left );
+    const double n2_x = -std::sin( right );
+    const double n2_y = std::cos( right );
+    const bool convex = ( half_angle <= M_PI * 0.5 );
+
+    const double close2 = ( close_dist + MARGIN ) * ( close_dist + MARGIN );
+
+    for ( std::size_t k = 0; k < M_boxes.size(); ++k )
+    {
+        const Box & box = M_boxes[k];
+
+        const double dx = std::max( std::max( box.min_x_ - pos.x, pos.x - box.max_x_ ), 0.0 );
+        const double dy = std::max( std::max( box.min_y_ - pos.y, pos.y - box.max_y_ ), 0.0 );
+        bool candidate = ( dx * dx + dy * dy <= close2 );
+
+        if ( ! candidate )
+        {
+            const double xs[2] = { box.min_x_ - pos.x, box.max_x_ - pos.x };
+            const double ys[2] = { box.min_y_ - pos.y, box.max_y_ - pos.y };
+            bool out1 = true;
+            bool out2 = true;
+            bool out_both = true;
+            for ( int i = 0; i < 2; ++i )
+            {
+                for ( int j = 0; j < 2; ++j )
+                {
+                    const bool o1 = ( xs[i] * n1_x + ys[j] * n1_y < -MARGIN );
+                    const bool o2 = ( xs[i] * n2_x + ys[j] * n2_y < -MARGIN );
+                    out1 = out1 && o1;
+                    out2 = out2 && o2;
+                    out_both = out_both && o1 && o2;
+                }
+            }
+
+            candidate = ( convex
+                          ? ! ( out1 || out2 )
+                          : ! out_both );
+        }
+
+        if ( candidate )
+        {
+            result.insert( result.end(),
+                           M_items.begin() + M_begin[k],
+                           M_items.begin() + M_begin[k + 1] );
+        }
+    }
+
+    std::sort( result.begin(), result.end() );
+}
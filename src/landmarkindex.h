@@ -0,0 +1,84 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              landmarkindex.h
+              Grid of the landmarks for culling them by view cone
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_LANDMARKINDEX_H
+#define RCSSSERVER_LANDMARKINDEX_H
+
+#include "object.h"
+
+#include <vector>
+#include <cstddef>
+
+/*!
+  \class LandmarkIndex
+  \brief a uniform grid over the static landmarks.
+
+  Each cell keeps the indices of its landmarks and their bounding box.
+  A query drops the cells whose box lies entirely outside the view cone
+  and entirely beyond the close distance, and returns the landmarks of
+  the other cells.  The tests are done on the boxes with a small
+  margin, so a landmark that the exact test in the visual sender would
+  accept is never dropped; the result is a superset that still has to
+  be checked one by one.
+ */
+class LandmarkIndex {
+private:
+    struct Box {
+        double min_x_;
+        double min_y_;
+        double max_x_;
+        double max_y_;
+    };
+
+    std::size_t M_size; //!< number of indexed landmarks
+    std::vector< Box > M_boxes; //!< bounding box of each non-empty cell
+    std::vector< std::size_t > M_begin; //!< first item of each cell, and the end
+    std::vector< std::size_t > M_items; //!< landmark indices, cell by cell
+
+public:
+    LandmarkIndex();
+
+    void build( const std::vector< PObject * > & landmarks );
+
+    //! the number of landmarks the index was built for
+    std::size_t size() const
+      {
+          return M_size;
+      }
+
+    /*!
+      \brief find the landmarks that can be seen
+      \param pos the position of the viewer
+      \param face the global direction of the viewer's face
+      \param half_angle half the width of the view cone. From pi on
+      every landmark is reported.
+      \param close_dist the distance within which landmarks outside the
+      view cone are still reported
+      \param result the candidate indices in increasing order
+     */
+    void query( const PVector & pos,
+                const double & face,
+                const double & half_angle,
+                const double & close_dist,
+                std::vector< std::size_t > & result ) const;
+};
+
+#endif
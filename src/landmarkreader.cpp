@@ -724,7 +724,8 @@ LandmarkReader::addFlag( const LandmarkReader::flag_t & flag,
     {
         sname = std::string( "(g " ) + flag.name + ")";
         lname = std::string( "(goal " ) + flag.name + ")";
-        M_field.addLandmark( new PObject( lname, sname,
+        M_field.addLandmark( new PObject( M_field.newObjectId(),
+                                          lname, sname,
                                           O_TYPE_GOAL_NAME,
                                           O_TYPE_GOAL_NAME_SHORT,
                                           PVector( flag.x, flag.y ),
@@ -734,7 +735,8 @@ LandmarkReader::addFlag( const LandmarkReader::flag_t & flag,
     {
         sname = std::string( "(f " ) + flag.name + ")";
         lname = std::string( "(flag " ) + flag.name + ")";
-        M_field.addLandmark( new PObject( lname, sname,
+        M_field.addLandmark( new PObject( M_field.newObjectId(),
+                                          lname, sname,
                                           O_TYPE_FLAG_NAME,
                                           O_TYPE_FLAG_NAME_SHORT,
                                           PVector( flag.x, flag.y ),
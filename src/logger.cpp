@@ -25,6 +25,7 @@
 
 #include "logger.h"
 
+#include "asyncostream.h"
 #include "player.h"
 #include "coach.h"
 #include "stadium.h"
@@ -331,6 +332,12 @@ Logger::openGameLog( const Stadium & stadium )
         return false;
     }
 
+    if ( ServerParam::instance().outputThread() )
+    {
+        // compress and write in the background
+        M_impl->game_log_ = new AsyncOStream( M_impl->game_log_ );
+    }
+
     // write header and configration parameters
     if ( ! setSenders( stadium ) )
     {
@@ -416,6 +423,11 @@ Logger::openTextLog()
         return false;
     }
 
+    if ( ServerParam::instance().outputThread() )
+    {
+        M_impl->text_log_ = new AsyncOStream( M_impl->text_log_ );
+    }
+
     return true;
 }
 
@@ -867,9 +879,15 @@ Logger::writeGameLogV1()
     disp.body.show.pos[0].x = htons( (Int16)rint( ( stadium.ball().pos().x * SHOWINFO_SCALE ) ) );
     disp.body.show.pos[0].y = htons( (Int16)rint( ( stadium.ball().pos().y * SHOWINFO_SCALE ) ) );
 
-    const Stadium::PlayerCont & players = stadium.players();
+    const std::vector< const Player * > & players = stadium.binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &disp.body.show.pos[i+1], 0, sizeof( disp.body.show.pos[i+1] ) );
+            continue;
+        }
+
         disp.body.show.pos[i+1].enable = htons( players[i]->state() );
         disp.body.show.pos[i+1].x = htons( (Int16)rint( players[i]->pos().x * SHOWINFO_SCALE ) );
         disp.body.show.pos[i+1].y = htons( (Int16)rint( players[i]->pos().y * SHOWINFO_SCALE ) );
@@ -925,9 +943,15 @@ Logger::writeGameLogV2()
     show.pos[0].x = htons( (Int16)rint( ( stadium.ball().pos().x * SHOWINFO_SCALE ) ) );
     show.pos[0].y = htons( (Int16)rint( ( stadium.ball().pos().y * SHOWINFO_SCALE ) ) );
 
-    const Stadium::PlayerCont & players = stadium.players();
+    const std::vector< const Player * > & players = stadium.binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &show.pos[i+1], 0, sizeof( show.pos[i+1] ) );
+            continue;
+        }
+
         show.pos[i+1].enable = htons( players[i]->state() );
         show.pos[i+1].x = htons( (Int16)rint( players[i]->pos().x * SHOWINFO_SCALE ) );
         show.pos[i+1].y = htons( (Int16)rint( players[i]->pos().y * SHOWINFO_SCALE ) );
@@ -1036,9 +1060,15 @@ Logger::writeGameLogV3()
     show.ball.deltax = htonl( (Int32)rint( ( stadium.ball().vel().x * SHOWINFO_SCALE2 ) ) );
     show.ball.deltay = htonl( (Int32)rint( ( stadium.ball().vel().y * SHOWINFO_SCALE2) ) );
 
-    const Stadium::PlayerCont & players = stadium.players();
+    const std::vector< const Player * > & players = stadium.binaryFormatPlayers();
     for ( int i = 0; i < MAX_PLAYER * 2; ++i )
     {
+        if ( ! players[i] )
+        {
+            std::memset( &show.pos[i], 0, sizeof( show.pos[i] ) );
+            continue;
+        }
+
         show.pos[i].mode = htons( players[i]->state() );
         show.pos[i].type = htons( players[i]->playerTypeId() );
 
@@ -42,12 +42,17 @@
 
 namespace {
 
-Stadium Std;
+Stadium * g_stadium = nullptr;
 
 void
 sigHandle( int )
 {
-    Std.finalize( "Server Killed. Exiting..." );
+    // the match is finalized by the timer on the main thread once its
+    // loop has ended
+    if ( g_stadium )
+    {
+        g_stadium->interrupt();
+    }
 }
 
 }
@@ -79,26 +84,37 @@ main( int argc, char *argv[] )
         return 1;
     }
 
-    if ( ! Std.init() )
     {
-        ServerParam::instance().clear();
-        return 1;
+        // the stadium owns all per-match state, so it is created only
+        // after the parameters are ready and destroyed before they are
+        // cleared.
+        Stadium stadium;
+        g_stadium = &stadium;
+
+        if ( ! stadium.init() )
+        {
+            g_stadium = nullptr;
+            ServerParam::instance().clear();
+            return 1;
+        }
+
+        std::shared_ptr< Timer > timer;
+        if ( ServerParam::instance().synchMode() )
+        {
+            timer = std::shared_ptr< Timer >( new SyncTimer( stadium ) );
+        }
+        else
+        {
+            timer = std::shared_ptr< Timer >( new StandardTimer( stadium ) );
+        }
+
+        std::cout << "\nHit CTRL-C to exit\n";
+
+        timer->run();
+
+        g_stadium = nullptr;
     }
 
-    std::shared_ptr< Timer > timer;
-    if ( ServerParam::instance().synchMode() )
-    {
-        timer = std::shared_ptr< Timer >( new SyncTimer( Std ) );
-    }
-    else
-    {
-        timer = std::shared_ptr< Timer >( new StandardTimer( Std ) );
-    }
-
-    std::cout << "\nHit CTRL-C to exit\n";
-
-    timer->run();
-
     ServerParam::instance().clear();
 
     return 0;
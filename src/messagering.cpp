@@ -0,0 +1,258 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               messagering.cpp
+               Single producer/single consumer ring of messages
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "messagering.h"
+
+#include <algorithm>
+#include <iostream>
+#include <cstring>
+
+const std::size_t MessageRing::CONTROL_SIZE = 4 * 64;
+
+namespace {
+
+const std::uint32_t WRAP_MARK = 0xffffffff;
+
+inline
+std::uint32_t
+load_acquire( const std::uint32_t * p )
+{
+    return __atomic_load_n( p, __ATOMIC_ACQUIRE );
+}
+
+inline
+void
+store_release( std::uint32_t * p,
+               const std::uint32_t v )
+{
+    __atomic_store_n( p, v, __ATOMIC_RELEASE );
+}
+
+inline
+std::uint32_t
+padded( const std::uint32_t len )
+{
+    return ( len + 3 ) & ~std::uint32_t( 3 );
+}
+
+inline
+bool
+aligned( const std::uint32_t pos )
+{
+    return ( pos & 3 ) == 0;
+}
+
+}
+
+MessageRing::MessageRing()
+    : M_head( nullptr ),
+      M_tail( nullptr ),
+      M_seq( nullptr ),
+      M_sleeping( nullptr ),
+      M_data( nullptr ),
+      M_capacity( 0 ),
+      M_read_pos( 0 ),
+      M_write_pos( 0 ),
+      M_broken( false )
+{
+
+}
+
+void
+MessageRing::attach( void * control,
+                     char * data,
+                     const std::uint32_t capacity )
+{
+    char * p = static_cast< char * >( control );
+    M_head = reinterpret_cast< std::uint32_t * >( p );
+    M_tail = reinterpret_cast< std::uint32_t * >( p + 64 );
+    M_seq = reinterpret_cast< std::uint32_t * >( p + 128 );
+    M_sleeping = reinterpret_cast< std::uint32_t * >( p + 192 );
+    M_data = data;
+    M_capacity = capacity;
+    M_read_pos = *M_head;
+    M_write_pos = *M_tail;
+    M_broken = false;
+}
+
+void
+MessageRing::detach()
+{
+    M_head = M_tail = M_seq = M_sleeping = nullptr;
+    M_data = nullptr;
+    M_capacity = 0;
+    M_read_pos = M_write_pos = 0;
+}
+
+void
+MessageRing::setBroken()
+{
+    if ( ! broken() )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error: message ring corrupted by the peer" << std::endl;
+    }
+    __atomic_store_n( &M_broken, true, __ATOMIC_RELAXED );
+}
+
+bool
+MessageRing::empty() const
+{
+    return ! M_data
+        || broken()
+        || load_acquire( M_tail ) == M_read_pos;
+}
+
+bool
+MessageRing::write( const char * msg,
+                    const std::size_t len )
+{
+    if ( ! M_data
+         || broken()
+         || len + sizeof( std::uint32_t ) > M_capacity )
+    {
+        return false;
+    }
+
+    const std::uint32_t need = sizeof( std::uint32_t ) + padded( len );
+    if ( need > M_capacity )
+    {
+        return false;
+    }
+
+    // the shared tail may have been overwritten by the consumer, so
+    // only the own copy is used.  the head may be anything, but it
+    // must lie behind the tail within one capacity.
+    const std::uint32_t head = load_acquire( M_head );
+    std::uint32_t tail = M_write_pos;
+    if ( ! aligned( head )
+         || tail - head > M_capacity )
+    {
+        setBroken();
+        return false;
+    }
+    const std::uint32_t free_space = M_capacity - ( tail - head );
+
+    const std::uint32_t offset = tail & ( M_capacity - 1 );
+    const std::uint32_t until_end = M_capacity - offset;
+    if ( need > until_end )
+    {
+        if ( until_end + need > free_space )
+        {
+            return false;
+        }
+        std::memcpy( M_data + offset, &WRAP_MARK, sizeof( WRAP_MARK ) );
+        tail += until_end;
+    }
+    else if ( need > free_space )
+    {
+        return false;
+    }
+
+    char * dst = M_data + ( tail & ( M_capacity - 1 ) );
+    const std::uint32_t len32 = static_cast< std::uint32_t >( len );
+    std::memcpy( dst, &len32, sizeof( len32 ) );
+    std::memcpy( dst + sizeof( len32 ), msg, len );
+
+    M_write_pos = tail + need;
+    store_release( M_tail, M_write_pos );
+
+    // the sequence increment must not be reordered with a following
+    // consumerSleeping(), or a consumer that is about to sleep would
+    // miss this message.
+    __atomic_fetch_add( M_seq, 1, __ATOMIC_SEQ_CST );
+
+    return true;
+}
+
+int
+MessageRing::read( char * buf,
+                   const std::size_t len )
+{
+    if ( ! M_data
+         || broken() )
+    {
+        return -1;
+    }
+
+    // the shared head may have been overwritten by the producer, so
+    // only the own copy is used.  the tail and every record are
+    // checked against it before any byte is copied.
+    std::uint32_t head = M_read_pos;
+    const std::uint32_t tail = load_acquire( M_tail );
+    if ( ! aligned( tail )
+         || tail - head > M_capacity )
+    {
+        setBroken();
+        return -1;
+    }
+
+    while ( head != tail )
+    {
+        const std::uint32_t offset = head & ( M_capacity - 1 );
+        const std::uint32_t until_end = M_capacity - offset;
+        const char * src = M_data + offset;
+        std::uint32_t size;
+        std::memcpy( &size, src, sizeof( size ) );
+
+        if ( size == WRAP_MARK )
+        {
+            if ( until_end > tail - head )
+            {
+                setBroken();
+                return -1;
+            }
+            head += until_end;
+            continue;
+        }
+
+        // compared one by one, so that padding a huge size cannot wrap
+        if ( size > tail - head
+             || size > until_end
+             || sizeof( size ) + padded( size ) > tail - head
+             || sizeof( size ) + padded( size ) > until_end )
+        {
+            setBroken();
+            return -1;
+        }
+
+        const std::size_t n = std::min( static_cast< std::size_t >( size ), len );
+        std::memcpy( buf, src + sizeof( size ), n );
+        M_read_pos = head + sizeof( size ) + padded( size );
+        store_release( M_head, M_read_pos );
+        return static_cast< int >( n );
+    }
+
+    M_read_pos = head;
+    store_release( M_head, head );
+    return -1;
+}
+
+bool
+MessageRing::consumerSleeping() const
+{
+    return M_sleeping
+        && __atomic_load_n( M_sleeping, __ATOMIC_SEQ_CST );
+}
@@ -0,0 +1,116 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                messagering.h
+               Single producer/single consumer ring of messages
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_MESSAGERING_H
+#define RCSSSERVER_MESSAGERING_H
+
+#include <cstddef>
+#include <cstdint>
+
+/*!
+  \class MessageRing
+  \brief lock-free queue of variable sized messages between one producer
+  and one consumer thread or process.
+
+  The ring does not own its memory.  It works on a control block of
+  CONTROL_SIZE bytes and a data area whose capacity is a power of two,
+  both zero filled before the first use.  The control block holds head
+  (read position, written by the consumer), tail (write position,
+  written by the producer), seq (incremented after every message) and
+  sleeping (set by a consumer that waits on seq), each a 32 bit word on
+  its own cache line.  Positions run freely and are taken modulo the
+  capacity.  A message is stored as its 32 bit length followed by its
+  bytes, padded to a multiple of 4 bytes.  The length 0xffffffff marks
+  the unused end of the data area; the next message then starts at
+  offset 0.
+
+  The other side may be a client process, so each side keeps its own
+  position and only trusts the peer's position and records after they
+  pass a bounds check.  A violation breaks the ring for good: broken()
+  is set, read() and write() fail, and the owner has to drop the peer.
+ */
+class MessageRing {
+public:
+    static const std::size_t CONTROL_SIZE;
+
+private:
+    std::uint32_t * M_head;
+    std::uint32_t * M_tail;
+    std::uint32_t * M_seq;
+    std::uint32_t * M_sleeping;
+    char * M_data;
+    std::uint32_t M_capacity;
+
+    std::uint32_t M_read_pos; //!< consumer's copy of head
+    std::uint32_t M_write_pos; //!< producer's copy of tail
+    bool M_broken;
+
+    void setBroken();
+
+public:
+    MessageRing();
+
+    void attach( void * control,
+                 char * data,
+                 const std::uint32_t capacity );
+
+    void detach();
+
+    bool isAttached() const
+      {
+          return M_data != nullptr;
+      }
+
+    //! true if the peer has corrupted the ring
+    bool broken() const
+      {
+          return __atomic_load_n( &M_broken, __ATOMIC_RELAXED );
+      }
+
+    //! consumer side: true if no message is waiting
+    bool empty() const;
+
+    /*!
+      \brief producer side: append one message
+      \return false if there is not enough free space or the ring is
+      broken
+     */
+    bool write( const char * msg,
+                const std::size_t len );
+
+    /*!
+      \brief consumer side: take the next message
+      \return the size of the message, which is truncated to len bytes,
+      or -1 if there is none or the ring is broken
+     */
+    int read( char * buf,
+              const std::size_t len );
+
+    //! producer side: true if the consumer waits on seqWord()
+    bool consumerSleeping() const;
+
+    std::uint32_t * seqWord() const
+      {
+          return M_seq;
+      }
+};
+
+#endif
@@ -161,7 +161,8 @@ Monitor::setSenders()
         rcss::InitSenderMonitor::Params init_params( getTransport(),
                                                      *this,
                                                      ser,
-                                                     M_stadium );
+                                                     M_stadium,
+                                                     M_stadium.initPayloadCache() );
         rcss::InitSenderMonitor::Creator init_cre;
         if ( ! rcss::InitSenderMonitor::factory().getCreator( init_cre,
                                                               (int)version() ) )
@@ -532,6 +533,8 @@ Monitor::compression( const char * command )
         return false;
     }
 
+    setInputCompressionLevel( level );
+
     std::ostringstream reply;
     reply << "(ok compression " << level << ")";
     sendMsg( MSG_BOARD, reply.str().c_str() );
@@ -620,7 +623,7 @@ Monitor::coach_move( const char * command )
                           PLAYER_NAME_FORMAT,
                           teamname, &unum ) != 2
              || unum < 1
-             || MAX_PLAYER < unum )
+             || ServerParam::instance().teamSize() < unum )
         {
             sendMsg( MSG_BOARD, "(error illegal_object_form)" );
             return false;
@@ -0,0 +1,428 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              networkingest.cpp
+               Background thread receiving dedicated client sockets
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "networkingest.h"
+
+#include "param.h"
+#include "remoteclient.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <iostream>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif
+#ifdef HAVE_SYS_EVENTFD_H
+#include <sys/eventfd.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <fcntl.h>
+
+#if defined(HAVE_SYS_EPOLL_H) && defined(HAVE_SYS_EVENTFD_H)
+#define RCSS_NETWORK_INGEST 1
+#endif
+
+const std::size_t ClientInbox::DEFAULT_CAPACITY = 64 * 1024;
+
+ClientInbox::ClientInbox( const std::size_t capacity )
+    : M_memory(),
+      M_ring(),
+      M_error( 0 ),
+      M_comp_level( -1 )
+{
+    std::uint32_t cap = 4096;
+    while ( cap < capacity )
+    {
+        cap <<= 1;
+    }
+
+    M_memory.resize( MessageRing::CONTROL_SIZE + cap, 0 );
+    M_ring.attach( M_memory.data(), M_memory.data() + MessageRing::CONTROL_SIZE, cap );
+}
+
+bool
+ClientInbox::push( const char * msg,
+                   const std::size_t len )
+{
+#ifdef HAVE_LIBZ
+    if ( M_comp_level.load( std::memory_order_acquire ) >= 0 )
+    {
+        M_decomp.decompress( msg, len, Z_SYNC_FLUSH );
+        char * out;
+        int size;
+        M_decomp.getOutput( out, size );
+        if ( size <= 0 )
+        {
+            return true;
+        }
+
+        // truncated like a datagram that does not fit the receive buffer
+        return M_ring.write( out, std::min( static_cast< std::size_t >( size ),
+                                            static_cast< std::size_t >( MaxMesg ) ) );
+    }
+#endif
+
+    return M_ring.write( msg, len );
+}
+
+
+namespace {
+
+#ifdef RCSS_NETWORK_INGEST
+void
+signal_event( const int fd )
+{
+    const std::uint64_t one = 1;
+    while ( ::write( fd, &one, sizeof( one ) ) < 0
+            && errno == EINTR )
+    {
+
+    }
+}
+
+void
+clear_event( const int fd )
+{
+    std::uint64_t count;
+    while ( ::read( fd, &count, sizeof( count ) ) < 0
+            && errno == EINTR )
+    {
+
+    }
+}
+#endif
+
+}
+
+NetworkIngest::NetworkIngest()
+    : M_epoll_fd( -1 ),
+      M_control_fd( -1 ),
+      M_notify_fd( -1 ),
+      M_stop( false )
+{
+
+}
+
+NetworkIngest::~NetworkIngest()
+{
+    stop();
+}
+
+bool
+NetworkIngest::start()
+{
+    stop();
+
+#ifdef RCSS_NETWORK_INGEST
+    M_epoll_fd = ::epoll_create1( EPOLL_CLOEXEC );
+    M_control_fd = ::eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+    M_notify_fd = ::eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = nullptr;
+    if ( M_epoll_fd < 0
+         || M_control_fd < 0
+         || M_notify_fd < 0
+         || ::epoll_ctl( M_epoll_fd, EPOLL_CTL_ADD, M_control_fd, &ev ) < 0 )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error setting up the network thread: "
+                  << std::strerror( errno ) << std::endl;
+        stop();
+        return false;
+    }
+
+    M_stop = false;
+    try
+    {
+        M_thread = std::thread( &NetworkIngest::run, this );
+    }
+    catch ( std::exception & e )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error starting the network thread: "
+                  << e.what() << std::endl;
+        stop();
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+NetworkIngest::stop()
+{
+#ifdef RCSS_NETWORK_INGEST
+    if ( M_thread.joinable() )
+    {
+        M_stop = true;
+        signal_event( M_control_fd );
+        M_thread.join();
+    }
+
+    for ( auto & e : M_entries )
+    {
+        ::close( e.second->fd_ );
+    }
+    M_entries.clear();
+    M_retired.clear();
+
+    for ( const Request & req : M_requests )
+    {
+        if ( req.fd_ >= 0 )
+        {
+            ::close( req.fd_ );
+        }
+    }
+    M_requests.clear();
+
+    for ( int * fd : { &M_epoll_fd, &M_control_fd, &M_notify_fd } )
+    {
+        if ( *fd >= 0 )
+        {
+            ::close( *fd );
+            *fd = -1;
+        }
+    }
+#endif
+}
+
+void
+NetworkIngest::add( RemoteClient * client )
+{
+    if ( ! isRunning() )
+    {
+        return;
+    }
+
+#ifdef RCSS_NETWORK_INGEST
+    Request req;
+    req.client_ = client;
+    req.fd_ = ::fcntl( client->getFD(), F_DUPFD_CLOEXEC, 0 );
+    if ( req.fd_ < 0 )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error duplicating client socket: "
+                  << std::strerror( errno ) << std::endl;
+        client->setInbox( std::shared_ptr< ClientInbox >() );
+        return;
+    }
+    req.inbox_ = std::make_shared< ClientInbox >();
+
+    client->setInbox( req.inbox_ );
+    pushRequest( req );
+#endif
+}
+
+void
+NetworkIngest::remove( const RemoteClient * client )
+{
+    if ( ! isRunning() )
+    {
+        return;
+    }
+
+    Request req;
+    req.client_ = client;
+    req.fd_ = -1;
+    pushRequest( req );
+}
+
+void
+NetworkIngest::clearNotification()
+{
+#ifdef RCSS_NETWORK_INGEST
+    if ( M_notify_fd >= 0 )
+    {
+        clear_event( M_notify_fd );
+    }
+#endif
+}
+
+void
+NetworkIngest::pushRequest( const Request & req )
+{
+#ifdef RCSS_NETWORK_INGEST
+    {
+        std::lock_guard< std::mutex > lock( M_requests_mutex );
+        M_requests.push_back( req );
+    }
+    signal_event( M_control_fd );
+#else
+    (void)req;
+#endif
+}
+
+void
+NetworkIngest::run()
+{
+    blockTerminationSignals();
+
+#ifdef RCSS_NETWORK_INGEST
+    epoll_event events[64];
+
+    while ( ! M_stop )
+    {
+        const int n = ::epoll_wait( M_epoll_fd, events, 64, -1 );
+        if ( n < 0 )
+        {
+            if ( errno == EINTR )
+            {
+                continue;
+            }
+            std::cerr << __FILE__ << ": " << __LINE__
+                      << ": Error waiting for client sockets: "
+                      << std::strerror( errno ) << std::endl;
+            break;
+        }
+
+        bool queued = false;
+        for ( int i = 0; i < n; ++i )
+        {
+            if ( ! events[i].data.ptr )
+            {
+                clear_event( M_control_fd );
+                handleRequests();
+            }
+            else if ( receive( *static_cast< Entry * >( events[i].data.ptr ) ) )
+            {
+                queued = true;
+            }
+        }
+
+        M_retired.clear();
+
+        if ( queued )
+        {
+            signal_event( M_notify_fd );
+        }
+    }
+#endif
+}
+
+void
+NetworkIngest::handleRequests()
+{
+#ifdef RCSS_NETWORK_INGEST
+    std::vector< Request > requests;
+    {
+        std::lock_guard< std::mutex > lock( M_requests_mutex );
+        requests.swap( M_requests );
+    }
+
+    for ( const Request & req : requests )
+    {
+        auto it = M_entries.find( req.client_ );
+        if ( it != M_entries.end() )
+        {
+            // the entry may be in the current batch of events, so it
+            // is kept until that batch is done.
+            ::epoll_ctl( M_epoll_fd, EPOLL_CTL_DEL, it->second->fd_, nullptr );
+            ::close( it->second->fd_ );
+            it->second->fd_ = -1;
+            M_retired.push_back( std::move( it->second ) );
+            M_entries.erase( it );
+        }
+
+        if ( req.fd_ < 0 )
+        {
+            continue;
+        }
+
+        std::unique_ptr< Entry > entry( new Entry );
+        entry->fd_ = req.fd_;
+        entry->inbox_ = req.inbox_;
+
+        epoll_event ev;
+        ev.events = EPOLLIN | EPOLLPRI;
+        ev.data.ptr = entry.get();
+        if ( ::epoll_ctl( M_epoll_fd, EPOLL_CTL_ADD, entry->fd_, &ev ) < 0 )
+        {
+            std::cerr << __FILE__ << ": " << __LINE__
+                      << ": Error registering client socket: "
+                      << std::strerror( errno ) << std::endl;
+            entry->inbox_->setError( errno );
+            ::close( entry->fd_ );
+            continue;
+        }
+
+        M_entries[req.client_] = std::move( entry );
+    }
+#endif
+}
+
+bool
+NetworkIngest::receive( Entry & entry )
+{
+    bool queued = false;
+
+#ifdef RCSS_NETWORK_INGEST
+    char buffer[ MaxMesg ];
+
+    while ( entry.fd_ >= 0 )
+    {
+        const ssize_t ret = ::recv( entry.fd_, buffer, sizeof( buffer ), 0 );
+        if ( ret >= 0 )
+        {
+            // like a full socket buffer, a full inbox drops the datagram
+            entry.inbox_->push( buffer, ret );
+            queued = true;
+        }
+        else if ( errno == EINTR )
+        {
+            continue;
+        }
+        else
+        {
+            if ( errno != EWOULDBLOCK
+                 && errno != EAGAIN )
+            {
+                // reported and closed by the client on the simulation thread
+                entry.inbox_->setError( errno );
+                ::epoll_ctl( M_epoll_fd, EPOLL_CTL_DEL, entry.fd_, nullptr );
+                queued = true;
+            }
+            break;
+        }
+    }
+#else
+    (void)entry;
+#endif
+
+    return queued;
+}
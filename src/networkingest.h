@@ -0,0 +1,211 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               networkingest.h
+               Background thread receiving dedicated client sockets
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_NETWORKINGEST_H
+#define RCSSSERVER_NETWORKINGEST_H
+
+#include "messagering.h"
+#include "compress.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <cstddef>
+
+class RemoteClient;
+
+/*!
+  \class ClientInbox
+  \brief datagrams received for one client, waiting to be processed by
+  the simulation thread.
+
+  The ingest thread is the only producer and the simulation thread the
+  only consumer.  A socket error ends the stream: it is recorded once
+  the last datagram before it has been queued.  Once the simulation
+  thread has set a compression level, the datagrams are decompressed
+  by the ingest thread before they are queued.
+ */
+class ClientInbox {
+public:
+    static const std::size_t DEFAULT_CAPACITY;
+
+private:
+    std::vector< char > M_memory;
+    MessageRing M_ring;
+    std::atomic< int > M_error;
+    std::atomic< int > M_comp_level;
+
+#ifdef HAVE_LIBZ
+    Decompressor M_decomp; //!< used by the ingest thread only
+#endif
+
+    ClientInbox( const ClientInbox & ) = delete;
+    ClientInbox & operator=( const ClientInbox & ) = delete;
+
+public:
+    explicit
+    ClientInbox( const std::size_t capacity = DEFAULT_CAPACITY );
+
+    /*!
+      \brief ingest thread: queue a datagram, decompressed if a
+      compression level is set, or drop it if the inbox is full
+     */
+    bool push( const char * msg,
+               const std::size_t len );
+
+    //! simulation thread: see MessageRing::read()
+    int pop( char * buf,
+             const std::size_t len )
+      {
+          return M_ring.read( buf, len );
+      }
+
+    bool empty() const
+      {
+          return M_ring.empty();
+      }
+
+    void setError( const int err )
+      {
+          M_error.store( err, std::memory_order_release );
+      }
+
+    //! the errno value that ended the stream, or 0
+    int error() const
+      {
+          return M_error.load( std::memory_order_acquire );
+      }
+
+    /*!
+      \brief simulation thread: decompress the datagrams received from
+      now on, or stop decompressing if level is negative
+     */
+    void setCompressionLevel( const int level )
+      {
+          M_comp_level.store( level, std::memory_order_release );
+      }
+};
+
+
+/*!
+  \class NetworkIngest
+  \brief thread that receives the dedicated sockets of the registered
+  clients into their inboxes.
+
+  While the simulation thread updates the world, the datagrams of the
+  next cycle are already read off the sockets and decompressed, so the
+  receive step only has to parse them.  Parsing stays on the simulation
+  thread, because the parsers act on the players directly.
+
+  A client switches to compression in the middle of its message stream.
+  The simulation thread sets the level of the inbox before it replies
+  to the compression command, so every datagram the client compresses
+  is received after the level is set, and the earlier ones are queued
+  as they are.
+
+  The thread works on its own duplicates of the socket descriptors, so
+  a client may close its socket at any time.  Clients are registered
+  and unregistered through a request list that is passed to the thread
+  with an eventfd.  Where threads or epoll are not available, start()
+  fails and the clients keep being read directly.
+ */
+class NetworkIngest {
+private:
+    struct Request {
+        const RemoteClient * client_;
+        int fd_; //!< duplicated descriptor, or -1 to unregister
+        std::shared_ptr< ClientInbox > inbox_;
+    };
+
+    struct Entry {
+        int fd_;
+        std::shared_ptr< ClientInbox > inbox_;
+    };
+
+    int M_epoll_fd;
+    int M_control_fd; //!< wakes up the thread for new requests
+    int M_notify_fd; //!< readable when some inbox received data
+
+    std::thread M_thread;
+    std::atomic< bool > M_stop;
+
+    std::mutex M_requests_mutex;
+    std::vector< Request > M_requests;
+
+    //! owned by the thread
+    std::unordered_map< const RemoteClient *, std::unique_ptr< Entry > > M_entries;
+    std::vector< std::unique_ptr< Entry > > M_retired;
+
+    NetworkIngest( const NetworkIngest & ) = delete;
+    NetworkIngest & operator=( const NetworkIngest & ) = delete;
+
+public:
+    NetworkIngest();
+
+    //! stops the thread
+    ~NetworkIngest();
+
+    //! \return false if the thread could not be started
+    bool start();
+
+    void stop();
+
+    bool isRunning() const
+      {
+          return M_thread.joinable();
+      }
+
+    /*!
+      \brief have the current socket of client received into a new inbox,
+      which is handed to the client.
+     */
+    void add( RemoteClient * client );
+
+    //! stop receiving for client
+    void remove( const RemoteClient * client );
+
+    /*!
+      \brief the descriptor that becomes readable when data has been
+      queued, or -1 if the thread is not running.
+     */
+    int getFD() const
+      {
+          return M_notify_fd;
+      }
+
+    //! reset the readiness of getFD()
+    void clearNotification();
+
+private:
+    void pushRequest( const Request & req );
+
+    void run();
+
+    void handleRequests();
+
+    //! \return true if some datagram was queued
+    bool receive( Entry & entry );
+};
+
+#endif
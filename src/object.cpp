@@ -344,16 +344,15 @@ nearestPost( const PVector & pos,
  *===================================================================
  */
 
-int PObject::S_object_count = 0;
-
 /* pfr 06/07/200 added short name support */
-PObject::PObject( const std::string & name,
+PObject::PObject( const int id,
+                  const std::string & name,
                   const std::string & short_name,
                   const std::string & close_name,
                   const std::string & short_close_name,
                   const PVector & p,
                   const double & v )
-    : M_id( S_object_count ),
+    : M_id( id ),
       M_name( name ),
       M_short_name( short_name ),
       M_close_name( close_name ),
@@ -363,7 +362,7 @@ PObject::PObject( const std::string & name,
       M_pos( p ),
       M_enable( true )
 {
-    ++S_object_count;
+
 }
 
 std::ostream &
@@ -391,8 +390,10 @@ MPObject::MPObject( Stadium & stadium,
                     const std::string & short_name,
                     const std::string & close_name,
                     const std::string & short_close_name )
-    : PObject( name, short_name,
+    : PObject( stadium.newObjectId(),
+               name, short_name,
                close_name, short_close_name )
+    , M_moves( 0 )
     , M_stadium( stadium )
     , M_vel( 0.0,0.0 )
     , M_accel( 0.0,0.0 )
@@ -425,6 +426,7 @@ MPObject::moveTo( const PVector & pos,
     M_pos = pos;
     M_vel = vel;
     M_accel = accel;
+    moved();
 }
 
 void
@@ -443,62 +445,14 @@ MPObject::setConstant( const double & size,
     M_max_accel = max_accel;
 }
 
-PVector
-MPObject::noise()
-{
-    double maxrnd = M_randp * vel().r();
-    return PVector::fromPolar( drand( 0.0, maxrnd ),
-                               drand( -M_PI, M_PI ) );
-    //return PVector( drand( -maxrnd, maxrnd ),
-    //                drand( -maxrnd, maxrnd ) );
-}
-
-PVector
-MPObject::wind()
-{
-    const Weather & w = M_stadium.weather();
-
-    if ( w.windRand() < EPS )
-    {
-        return PVector( 0.0, 0.0 );
-    }
-
-    const double speed = M_vel.r();
-    return PVector( speed * ( w.windVector().x +
-                              drand( - w.windRand(), + w.windRand() ) ) /
-                    ( M_weight * ServerParam::instance().windWeight() ),
-                    speed * ( w.windVector().y +
-                              drand( - w.windRand(), + w.windRand() ) ) /
-                    ( M_weight * ServerParam::instance().windWeight() ));
-}
-
 void
 MPObject::_inc()
 {
-    if ( M_accel.x || M_accel.y )
-    {
-        double max_a = maxAccel();
-        double max_s = maxSpeed();
-
-        double tmp = M_accel.r();
-        if ( tmp > max_a )
-        {
-            M_accel *= ( max_a / tmp );
-        }
-
-        M_vel += M_accel;
-        tmp = M_vel.r();
-        if ( tmp > max_s )
-        {
-            M_vel *= ( max_s / tmp );
-        }
-    }
+    // the acceleration, the noise and the wind have already been
+    // added to the velocity by KinematicsBatch::accelerate()
 
     updateAngle();
 
-    M_vel += noise();
-    M_vel += wind();
-
     CArea post = nearestPost( pos(), M_size );
 
     //      std::cout << "pos = " << pos << endl;
@@ -620,6 +574,7 @@ MPObject::_inc()
     }
 
     M_pos = new_pos;
+    moved();
     M_vel *= M_decay;
     M_accel *= 0.0;
 }
@@ -653,6 +608,7 @@ MPObject::moveToCollisionPos()
         /*        cout << "colcount = " << obj->col_count << std::endl; */
         M_post_collision_pos /= M_collision_count;
         M_pos = M_post_collision_pos;
+        moved();
         /*        cout << "newpos = " << obj->pos << std::endl; */
     }
 
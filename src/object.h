@@ -371,9 +371,7 @@ operator!=( const CArea & lhs,
 class PObject {
 private:
 
-    static int S_object_count;
-
-    const int M_id;
+    const int M_id; //!< unique in the Field of the match
 
     std::string M_name;
     std::string M_short_name;
@@ -395,7 +393,8 @@ private:
 
 public:
 
-    PObject( const std::string & name,
+    PObject( const int id,
+             const std::string & name,
              const std::string & short_name,
              const std::string & close_name,
              const std::string & short_close_name,
@@ -477,6 +476,12 @@ class Stadium;
 
 class MPObject
     : public PObject {
+private:
+    unsigned long M_moves;
+
+    //! applies M_accel, the noise and the wind to M_vel before _inc() is called
+    friend class KinematicsBatch;
+
 protected:
     Stadium	& M_stadium;
 
@@ -523,6 +528,12 @@ public:
           return M_stadium;
       }
 
+    //! changes every time this object is moved
+    unsigned long moves() const
+      {
+          return M_moves;
+      }
+
     const
     PVector & vel() const
       {
@@ -534,20 +545,18 @@ public:
           return M_accel;
       }
 
+    //! moves the object, after the KinematicsBatch has accelerated it
     void _inc();
 
     void _turn()
       {
           turnImpl();
       }
-private:
-    PVector noise();
-    PVector wind();
-
 public:
     void moveTo( const PVector & pos )
       {
           M_pos = pos;
+          moved();
       }
 
     void moveTo( const PVector & pos,
@@ -593,6 +602,12 @@ public:
 
 protected:
 
+    //! to be called after M_pos has been changed
+    void moved()
+      {
+          ++M_moves;
+      }
+
     virtual
     void turnImpl() = 0;
 
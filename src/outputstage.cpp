@@ -0,0 +1,285 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               outputstage.cpp
+                Background thread sending the client messages
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "outputstage.h"
+
+#include "utility.h"
+
+#include <rcss/net/iouring.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <cerrno>
+#include <cstring>
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+namespace {
+
+int
+send_now( int fd,
+          const char * msg,
+          std::size_t len )
+{
+    for ( ; ; )
+    {
+        int sent = ::send( fd, msg, len, 0 );
+        if ( sent != -1 )
+        {
+            return sent;
+        }
+
+        if ( errno == EAGAIN
+             || errno == EWOULDBLOCK )
+        {
+            // the socket buffer is full.  the datagram is dropped, as it
+            // could be on the network, and the client is kept.
+            return static_cast< int >( len );
+        }
+
+        if ( errno != EINTR )
+        {
+            return -1;
+        }
+    }
+}
+
+}
+
+OutputStage::OutputStage()
+    : M_ring( nullptr ),
+      M_busy( false ),
+      M_stop( false )
+{
+
+}
+
+OutputStage::~OutputStage()
+{
+    stop();
+}
+
+bool
+OutputStage::start( rcss::net::IOURing * ring )
+{
+    stop();
+
+    M_ring = ring;
+    M_stop = false;
+    try
+    {
+        M_thread = std::thread( &OutputStage::run, this );
+    }
+    catch ( std::exception & e )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error starting the output thread: "
+                  << e.what() << std::endl;
+        M_ring = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void
+OutputStage::stop()
+{
+    if ( ! isRunning() )
+    {
+        return;
+    }
+
+    drain();
+
+    {
+        std::lock_guard< std::mutex > lock( M_mutex );
+        M_stop = true;
+    }
+    M_cond.notify_all();
+    M_thread.join();
+
+    M_ring = nullptr;
+}
+
+int
+OutputStage::queueSend( int fd,
+                        const char * msg,
+                        std::size_t len )
+{
+    if ( ! isRunning() )
+    {
+        return send_now( fd, msg, len );
+    }
+
+    Pending p;
+    p.fd_ = fd;
+    p.offset_ = M_front.data_.size();
+    p.len_ = len;
+
+    M_front.data_.insert( M_front.data_.end(), msg, msg + len );
+    M_front.pending_.push_back( p );
+
+    return static_cast< int >( len );
+}
+
+void
+OutputStage::release( int fd )
+{
+    {
+        std::unique_lock< std::mutex > lock( M_mutex );
+        waitIdle( lock );
+        M_failures.erase( std::remove_if( M_failures.begin(), M_failures.end(),
+                                          [fd]( const rcss::net::SendFailure & f )
+                                          {
+                                              return f.fd_ == fd;
+                                          } ),
+                          M_failures.end() );
+    }
+
+    for ( Pending & p : M_front.pending_ )
+    {
+        if ( p.fd_ == fd )
+        {
+            send_now( p.fd_, &M_front.data_[p.offset_], p.len_ );
+            p.fd_ = -1;
+        }
+    }
+}
+
+void
+OutputStage::takeFailures( std::vector< rcss::net::SendFailure > & failures )
+{
+    std::lock_guard< std::mutex > lock( M_mutex );
+    failures.insert( failures.end(), M_failures.begin(), M_failures.end() );
+    M_failures.clear();
+}
+
+void
+OutputStage::publish()
+{
+    if ( M_front.empty() )
+    {
+        return;
+    }
+
+    if ( ! isRunning() )
+    {
+        sendBatch( M_front );
+        M_front.clear();
+        return;
+    }
+
+    {
+        std::unique_lock< std::mutex > lock( M_mutex );
+        waitIdle( lock );
+        std::swap( M_front, M_back );
+        M_busy = true;
+    }
+    M_cond.notify_all();
+}
+
+void
+OutputStage::drain()
+{
+    publish();
+
+    std::unique_lock< std::mutex > lock( M_mutex );
+    waitIdle( lock );
+}
+
+void
+OutputStage::waitIdle( std::unique_lock< std::mutex > & lock )
+{
+    M_cond.wait( lock, [this] { return ! M_busy; } );
+}
+
+void
+OutputStage::run()
+{
+    blockTerminationSignals();
+
+    std::unique_lock< std::mutex > lock( M_mutex );
+
+    for ( ; ; )
+    {
+        M_cond.wait( lock, [this] { return M_busy || M_stop; } );
+        if ( ! M_busy )
+        {
+            break;
+        }
+
+        // the back batch belongs to this thread until M_busy is reset
+        lock.unlock();
+        sendBatch( M_back );
+        M_back.clear();
+        lock.lock();
+
+        M_busy = false;
+        M_cond.notify_all();
+    }
+}
+
+void
+OutputStage::sendBatch( Batch & batch )
+{
+    const bool use_ring = ( M_ring && M_ring->isOpen() );
+    std::vector< rcss::net::SendFailure > failures;
+
+    for ( const Pending & p : batch.pending_ )
+    {
+        if ( p.fd_ == -1 )
+        {
+            continue;
+        }
+
+        // like the direct sends, a lost datagram is not retried
+        if ( use_ring )
+        {
+            M_ring->queueSend( p.fd_, &batch.data_[p.offset_], p.len_ );
+        }
+        else if ( send_now( p.fd_, &batch.data_[p.offset_], p.len_ ) < 0 )
+        {
+            rcss::net::SendFailure f;
+            f.fd_ = p.fd_;
+            f.err_ = errno;
+            failures.push_back( f );
+        }
+    }
+
+    if ( use_ring )
+    {
+        M_ring->flush();
+        M_ring->takeFailures( failures );
+    }
+
+    if ( ! failures.empty() )
+    {
+        std::lock_guard< std::mutex > lock( M_mutex );
+        M_failures.insert( M_failures.end(), failures.begin(), failures.end() );
+    }
+}
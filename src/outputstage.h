@@ -0,0 +1,142 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                outputstage.h
+                Background thread sending the client messages
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_OUTPUTSTAGE_H
+#define RCSSSERVER_OUTPUTSTAGE_H
+
+#include <rcss/net/sendqueue.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+namespace rcss {
+namespace net {
+class IOURing;
+}
+}
+
+/*!
+  \class OutputStage
+  \brief double buffered queue of client messages, sent by a separate
+  thread.
+
+  The simulation thread fills the front batch while the output thread
+  sends the back batch.  publish() swaps the two at the end of each
+  timer event, so the system calls of one event overlap with the work
+  of the next.  It only waits if the previous batch has not been sent
+  yet.  If an open io_uring is given, the output thread submits its
+  batches there.
+
+  Only the system calls move to the output thread.  The messages are
+  still built on the simulation thread, which also takes the failed
+  sends back with takeFailures() and closes their clients.
+ */
+class OutputStage
+    : public rcss::net::SendQueue {
+private:
+    struct Pending {
+        int fd_;
+        std::size_t offset_;
+        std::size_t len_;
+    };
+
+    struct Batch {
+        std::vector< char > data_;
+        std::vector< Pending > pending_;
+
+        bool empty() const
+          {
+              return pending_.empty();
+          }
+
+        void clear()
+          {
+              data_.clear();
+              pending_.clear();
+          }
+    };
+
+    rcss::net::IOURing * M_ring;
+
+    std::thread M_thread;
+    std::mutex M_mutex;
+    std::condition_variable M_cond;
+    bool M_busy; //!< the back batch is being sent
+    bool M_stop;
+
+    Batch M_front; //!< filled by the simulation thread
+    Batch M_back; //!< sent by the output thread
+    //! sends of the output thread that failed, guarded by M_mutex
+    std::vector< rcss::net::SendFailure > M_failures;
+
+    OutputStage( const OutputStage & ) = delete;
+    OutputStage & operator=( const OutputStage & ) = delete;
+
+public:
+    OutputStage();
+
+    //! sends everything and stops the thread
+    virtual
+    ~OutputStage() override;
+
+    /*!
+      \param ring used by the output thread if it is open. may be null.
+      \return false if the thread could not be started
+     */
+    bool start( rcss::net::IOURing * ring );
+
+    void stop();
+
+    bool isRunning() const
+      {
+          return M_thread.joinable();
+      }
+
+    virtual
+    int queueSend( int fd,
+                   const char * msg,
+                   std::size_t len ) override;
+
+    //! waits for the back batch and sends the messages of fd at once
+    virtual
+    void release( int fd ) override;
+
+    virtual
+    void takeFailures( std::vector< rcss::net::SendFailure > & failures ) override;
+
+    //! hand the messages queued so far to the output thread
+    void publish();
+
+    //! publish and wait until everything has been sent
+    void drain();
+
+private:
+    void waitIdle( std::unique_lock< std::mutex > & lock );
+
+    void run();
+
+    void sendBatch( Batch & batch );
+};
+
+#endif
@@ -263,6 +263,10 @@ enum BallPosInfo {
 	BPI_MAX
 };
 
+/* the default team size, and the number of players of each team in the
+   fixed size binary monitor and log formats */
 #define MAX_PLAYER			11
+/* the largest team_size accepted */
+#define MAX_TEAM_SIZE			100
 
 #endif
@@ -222,6 +222,7 @@ Player::Player( Stadium & stadium,
 
     M_pos.x = -( unum() * 3 * team->side() );
     M_pos.y = - ServerParam::PITCH_WIDTH/2.0 - 3.0;
+    moved();
 
     setPlayerType( 0 );
     recoverAll();
@@ -437,6 +438,7 @@ Player::disable()
 
     M_pos.x = -( unum() * 3 * side() );
     M_pos.y = - ServerParam::PITCH_WIDTH/2.0 - 3.0;
+    moved();
     M_vel.x = 0.0;
     M_vel.y = 0.0;
     M_accel.x = 0.0;
@@ -1419,6 +1421,7 @@ Player::goalieCatch( double dir )
         mag -= ServerParam::instance().ballSize() + M_player_type->playerSize();
         new_pos.normalize( mag );
         M_pos += new_pos;
+        moved();
         M_angle_body = new_pos.th();
         M_vel = PVector();
     }
@@ -1495,6 +1498,7 @@ Player::goalieCatch( double dir )
         mag -= SP.ballSize() + M_player_type->playerSize();
         new_pos.normalize( mag );
         M_pos += new_pos;
+        moved();
         M_angle_body = new_pos.th();
         M_vel = PVector();
 
@@ -1574,6 +1578,7 @@ Player::move( double x,
 
         M_pos.x = x * side();
         M_pos.y = y * side();
+        moved();
         M_stadium.collisions();
     }
     else if ( ( M_stadium.playmode() == PM_FreeKick_Left
@@ -1585,6 +1590,7 @@ Player::move( double x,
         {
             M_pos.x = x * side();
             M_pos.y = y * side();
+            moved();
             ++M_goalie_moves_since_catch;
         }
         else
@@ -1672,14 +1678,17 @@ Player::change_view( rcss::pcom::VIEW_WIDTH viewWidth,
         }
         else
         {
+            M_stadium.scheduleVisual( *this, false );
             return;
         }
     }
     else
     {
+        M_stadium.scheduleVisual( *this, false );
         return;
     }
 
+    M_stadium.scheduleVisual( *this, false );
     ++M_change_view_count;
 }
 
@@ -1736,6 +1745,7 @@ Player::change_view( rcss::pcom::VIEW_WIDTH viewWidth )
     M_view_width = viewWidth;
     M_high_quality = true;
 
+    M_stadium.scheduleVisual( *this, false );
     ++M_change_view_count;
 }
 
@@ -1748,6 +1758,8 @@ Player::compression( int level )
         return;
     }
 
+    setInputCompressionLevel( level );
+
     std::ostringstream reply;
     reply << "(ok compression " << level << ")";
     send( reply.str().c_str() );
@@ -2185,6 +2197,7 @@ Player::synch_see()
 
     M_synch_see = true;
     M_high_quality = true;
+    M_stadium.scheduleVisual( *this, false );
 
     // TODO: move to the Observer
     send( "(ok synch_see)" );
@@ -2282,7 +2295,8 @@ Player::setSenders()
     rcss::InitSenderPlayer::Params init_params( getTransport(),
                                                 *this,
                                                 ser,
-                                                M_stadium );
+                                                M_stadium,
+                                                M_stadium.initPayloadCache() );
     rcss::InitSenderPlayer::Creator init_cre;
     if ( ! rcss::InitSenderPlayer::factory().getCreator( init_cre,
                                                          (int)version() ) )
@@ -2310,7 +2324,8 @@ Player::setSenders()
     rcss::AudioSenderPlayer::Params audio_params( getTransport(),
                                                   *this,
                                                   ser,
-                                                  M_stadium );
+                                                  M_stadium,
+                                                  M_stadium.broadcastCache() );
     rcss::AudioSenderPlayer::Creator audio_cre;
     if ( ! rcss::AudioSenderPlayer::factory().getCreator( audio_cre,
                                                           (int)version() ) )
@@ -2621,6 +2636,7 @@ void
 Player::place( const PVector & location )
 {
     M_pos = location;
+    moved();
     M_vel.assign( 0.0, 0.0 );
     M_accel.assign( 0.0, 0.0 );
 }
@@ -2632,6 +2648,7 @@ Player::place( const PVector & pos,
                const PVector & accel )
 {
     M_pos = pos;
+    moved();
     M_angle_body = angle;
     M_angle_body_committed = angle;
     M_vel = vel;
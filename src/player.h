@@ -309,6 +309,7 @@ public:
     // visual sensor
     //
     int visualSendInterval() const { return M_visual_send_interval; }
+    bool isSynchSee() const { return M_synch_see; }
     bool highQuality() const { return M_high_quality; }
     const double & visibleAngle() const { return M_visible_angle; }
     rcss::pcom::VIEW_WIDTH viewWidth() const { return M_view_width; }
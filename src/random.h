@@ -27,33 +27,196 @@
 #include <algorithm>
 #include <memory>
 #include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+
+/*!
+  \class CounterRNG
+  \brief a Philox4x32-10 counter based generator.
+
+  Each output block is a keyed hash of a 128 bit counter, so a stream
+  has no state besides its key and counter, and any stream can be
+  started at any point without drawing the numbers before it.  The
+  key holds the simulator seed and the purpose of the numbers, the
+  counter holds the block index, a step and the id of the stream.
+  Two streams with different keys, steps or ids do not overlap, and
+  their numbers do not depend on the order in which they are drawn.
+  It can be used as the generator of the standard distributions.
+ */
+class CounterRNG {
+public:
+    typedef std::uint32_t result_type;
+
+private:
+    std::uint32_t M_key[2];
+    std::uint32_t M_counter[4]; //!< block index, step ( low, high ), stream id
+    std::uint32_t M_block[4];
+    int M_used; //!< number of words of M_block already returned
+
+    static
+    std::uint32_t mulhilo( const std::uint32_t a,
+                           const std::uint32_t b,
+                           std::uint32_t & hi )
+      {
+          const std::uint64_t product = static_cast< std::uint64_t >( a ) * b;
+          hi = static_cast< std::uint32_t >( product >> 32 );
+          return static_cast< std::uint32_t >( product );
+      }
+
+    void generate()
+      {
+          std::uint32_t c0 = M_counter[0];
+          std::uint32_t c1 = M_counter[1];
+          std::uint32_t c2 = M_counter[2];
+          std::uint32_t c3 = M_counter[3];
+          std::uint32_t k0 = M_key[0];
+          std::uint32_t k1 = M_key[1];
+
+          for ( int round = 0; round < 10; ++round )
+          {
+              if ( round > 0 )
+              {
+                  k0 += 0x9E3779B9;
+                  k1 += 0xBB67AE85;
+              }
+
+              std::uint32_t hi0, hi1;
+              const std::uint32_t lo0 = mulhilo( 0xD2511F53, c0, hi0 );
+              const std::uint32_t lo1 = mulhilo( 0xCD9E8D57, c2, hi1 );
+              c0 = hi1 ^ c1 ^ k0;
+              c1 = lo1;
+              c2 = hi0 ^ c3 ^ k1;
+              c3 = lo0;
+          }
+
+          M_block[0] = c0;
+          M_block[1] = c1;
+          M_block[2] = c2;
+          M_block[3] = c3;
+          M_used = 0;
+
+          ++M_counter[0];
+      }
+
+public:
+
+    CounterRNG( const std::uint32_t seed,
+                const std::uint32_t purpose,
+                const std::uint32_t stream,
+                const std::uint64_t step = 0 )
+      {
+          M_key[0] = seed;
+          M_key[1] = purpose;
+          M_counter[3] = stream;
+          restart( step );
+      }
+
+    //! start the stream over at the beginning of the given step
+    void restart( const std::uint64_t step )
+      {
+          M_counter[0] = 0;
+          M_counter[1] = static_cast< std::uint32_t >( step );
+          M_counter[2] = static_cast< std::uint32_t >( step >> 32 );
+          M_used = 4;
+      }
+
+    static constexpr
+    result_type min()
+      {
+          return 0;
+      }
+
+    static constexpr
+    result_type max()
+      {
+          return 0xFFFFFFFF;
+      }
+
+    result_type operator()()
+      {
+          if ( M_used == 4 )
+          {
+              generate();
+          }
+          return M_block[M_used++];
+      }
+
+    //! a uniform value in [0, 1) with 53 random bits
+    double canonical()
+      {
+          const std::uint32_t a = (*this)() >> 5;
+          const std::uint32_t b = (*this)() >> 6;
+          return ( a * 67108864.0 + b ) * ( 1.0 / 9007199254740992.0 );
+      }
+
+    //! fill [first, first + n) with uniform values in [0, 1)
+    void fill( double * first,
+               const std::size_t n )
+      {
+          for ( std::size_t i = 0; i < n; ++i )
+          {
+              first[i] = canonical();
+          }
+      }
+};
 
 class DefaultRNG {
 public:
     typedef std::mt19937 Engine;
+
+    //! the purposes of the counter based streams, part of their keys
+    enum Purpose {
+        MOVE_NOISE = 1,
+        VISUAL_NOISE = 2,
+    };
+
 private:
 
     Engine M_engine;
+    Engine::result_type M_seed;
 
-    DefaultRNG() = default;
+    DefaultRNG()
+        : M_seed( Engine::default_seed )
+      { }
+
+    static
+    DefaultRNG & self()
+      {
+          static DefaultRNG the_instance;
+          return the_instance;
+      }
 
 public:
     static
     //DefaultRNG & instance()
     Engine & instance()
       {
-          static DefaultRNG the_instance;
-          return the_instance.M_engine;
+          return self().M_engine;
       }
 
     static
     //DefaultRNG & instance( const std::mt19937::result_type & value )
     Engine & seed( const Engine::result_type & value )
       {
+          self().M_seed = value;
           instance().seed( value );
           return instance();
       }
 
+    /*!
+      \brief a counter based stream derived from the simulator seed
+      \param purpose what the numbers are used for
+      \param id the id of the stream among those of the same purpose
+      \param step where the stream starts, usually a cycle count
+     */
+    static
+    CounterRNG stream( const Purpose purpose,
+                       const std::uint32_t id,
+                       const std::uint64_t step = 0 )
+      {
+          return CounterRNG( self().M_seed, purpose, id, step );
+      }
+
     // For GCC, moving this function out-of-line prevents inlining, which may
     // reduce overall object code size.  However, MSVC does not grok
     // out-of-line definitions of member function templates.
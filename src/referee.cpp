@@ -476,8 +476,6 @@ Referee::crossGoalLine( const Side side,
 void
 TimeRef::analyse()
 {
-    static int s_half_time_count = 0;
-
     const PlayMode pm = M_stadium.playmode();
     if ( pm == PM_BeforeKickOff
          || pm == PM_TimeOver
@@ -529,7 +527,7 @@ TimeRef::analyse()
         // overtime
         else if ( M_stadium.time() >= normal_time )
         {
-            int extra_count = ( s_half_time_count + 1 ) - param.nrNormalHalfs();
+            int extra_count = ( M_half_time_count + 1 ) - param.nrNormalHalfs();
 
             if ( ! M_stadium.teamLeft().enabled()
                  || ! M_stadium.teamRight().enabled() )
@@ -563,12 +561,12 @@ TimeRef::analyse()
                 // otherwise, the game is go into the overtime.
                 else
                 {
-                    ++s_half_time_count;
+                    ++M_half_time_count;
                     M_stadium.sendRefereeAudio( "time_extended" );
-                    Side kick_off_side = ( s_half_time_count % 2 == 0
+                    Side kick_off_side = ( M_half_time_count % 2 == 0
                                            ? LEFT
                                            : RIGHT );
-                    M_stadium.callHalfTime( kick_off_side, s_half_time_count );
+                    M_stadium.callHalfTime( kick_off_side, M_half_time_count );
                     placePlayersInTheirField();
                 }
 
@@ -576,14 +574,14 @@ TimeRef::analyse()
             }
         }
         // if not in overtime, check whether halfTime() cycles have been passed
-        else if ( M_stadium.time() >= param.halfTime() * ( s_half_time_count + 1 ) )
+        else if ( M_stadium.time() >= param.halfTime() * ( M_half_time_count + 1 ) )
         {
-            ++s_half_time_count;
-            Side kick_off_side = ( s_half_time_count % 2 == 0
+            ++M_half_time_count;
+            Side kick_off_side = ( M_half_time_count % 2 == 0
                                    ? LEFT
                                    : RIGHT );
             M_stadium.sendRefereeAudio( "half_time" );
-            M_stadium.callHalfTime( kick_off_side, s_half_time_count );
+            M_stadium.callHalfTime( kick_off_side, M_half_time_count );
             placePlayersInTheirField();
             return;
         }
@@ -815,8 +813,9 @@ Referee::checkFoul( const Player & tackler,
     // added red card probability
     std::bernoulli_distribution red_dst( ServerParam::instance().redCardProbability() );
 
-    const double ball_dist2 = tackler.pos().distance2( M_stadium.ball().pos() );
-    const double ball_angle = ( M_stadium.ball().pos() - tackler.pos() ).th();
+    const DistanceTable & distances = M_stadium.distances();
+    const double ball_dist2 = distances.ballDist2( tackler );
+    const double ball_angle = distances.ballDir( tackler );
 
     //std::cerr << M_stadium.time() << " (tackleTaken) "
     //          << " (tackler " << SideStr( tackler.side() ) << ' ' << tackler.unum() << ")"
@@ -849,14 +848,14 @@ Referee::checkFoul( const Player & tackler,
             continue; // no dashing
         }
 
-        PVector player_rel = p->pos() - tackler.pos();
-
-        if ( player_rel.r2() > ball_dist2 )
+        if ( distances.dist2( *p, tackler ) > ball_dist2 )
         {
             //std::cerr << "----> " << p->unum() << " ball near." << std::endl;
             continue; // further than ball
         }
 
+        PVector player_rel = p->pos() - tackler.pos();
+
         //std::cerr << "--> (player " << SideStr( p->side() ) << ' ' << p->unum() << ")\n";
 
         player_rel.rotate( -ball_angle );
@@ -1000,7 +999,7 @@ OffsideRef::checkIntentionalAction( const Player & kicker )
     for ( const Candidate & c : M_offside_candidates )
     {
         if ( c.player_ == &kicker
-             && c.player_->pos().distance2( M_stadium.ball().pos() )
+             && M_stadium.distances().ballDist2( *c.player_ )
              < std::pow( ServerParam::instance().offsideActiveArea(), 2 ) )
         {
             M_offside_pos = c.pos_;
@@ -2912,7 +2911,8 @@ KeepawayRef::KeepawayRef( Stadium & stadium )
       M_keepers( 0 ),
       M_takers( 0 ),
       M_time( 0 ),
-      M_take_time( 0 )
+      M_take_time( 0 ),
+      M_start_time( 0 )
 {
 
 }
@@ -2925,7 +2925,10 @@ KeepawayRef::analyse()
         return;
     }
 
-    static time_t s_start_time = std::time( nullptr );
+    if ( M_start_time == 0 )
+    {
+        M_start_time = std::time( nullptr );
+    }
 
     if ( M_stadium.playmode() == PM_PlayOn )
     {
@@ -2975,7 +2978,7 @@ KeepawayRef::analyse()
     }
     else if ( ServerParam::instance().kawayStart() >= 0 )
     {
-        if ( difftime( std::time( nullptr ), s_start_time ) > ServerParam::instance().kawayStart() )
+        if ( difftime( std::time( nullptr ), M_start_time ) > ServerParam::instance().kawayStart() )
         {
             M_stadium.changePlayMode( PM_PlayOn );
         }
@@ -3099,7 +3102,8 @@ PenaltyRef::PenaltyRef( Stadium& stadium )
       M_cur_pen_taker( NEUTRAL ),
       M_last_taker( nullptr ),
       M_prev_ball_pos( 0.0, 0.0 ),
-      M_timeover( false )
+      M_timeover( false ),
+      M_first_time( true )
 {
 
 }
@@ -3116,12 +3120,10 @@ PenaltyRef::analyse()
 void
 PenaltyRef::startPenaltyShootout()
 {
-    static bool first_time = true;
-
     const ServerParam & param = ServerParam::instance();
 
     // if normal and extra time are over -> start the penalty procedure or quit
-    if ( first_time
+    if ( M_first_time
          && param.penaltyShootOuts()
          && M_stadium.playmode() != PM_BeforeKickOff
          && M_stadium.teamLeft().point() == M_stadium.teamRight().point()
@@ -3167,7 +3169,7 @@ PenaltyRef::startPenaltyShootout()
         }
 
         penalty_init();
-        first_time = false;
+        M_first_time = false;
     }
 }
 
@@ -3533,7 +3535,7 @@ PenaltyRef::kickTaken( const Player & kicker,
     {
         // when penalty is taken, add player, multiple copies are deleted
         M_sLeftPenTaken.insert( kicker.unum() );
-        if ( M_sLeftPenTaken.size() == MAX_PLAYER )
+        if ( static_cast< int >( M_sLeftPenTaken.size() ) == ServerParam::instance().teamSize() )
         {
             M_sLeftPenTaken.clear();
         }
@@ -3542,7 +3544,7 @@ PenaltyRef::kickTaken( const Player & kicker,
     else if ( M_stadium.playmode() == PM_PenaltyReady_Right )
     {
         M_sRightPenTaken.insert( kicker.unum() );
-        if ( M_sRightPenTaken.size() == MAX_PLAYER )
+        if ( static_cast< int >( M_sRightPenTaken.size() ) == ServerParam::instance().teamSize() )
         {
             M_sRightPenTaken.clear();
         }
@@ -4136,7 +4138,7 @@ PenaltyRef::getCandidateTaker()
             continue;
         }
 
-        double d2 = p->pos().distance2( M_stadium.ball().pos() );
+        double d2 = M_stadium.distances().ballDist2( *p );
         if( d2 < min_dist2 )
         {
             min_dist2 = d2;
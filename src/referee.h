@@ -30,6 +30,7 @@
 #include "object.h"
 
 #include <set>
+#include <ctime>
 #include <vector>
 
 class Stadium;
@@ -286,11 +287,13 @@ public:
 class TimeRef
     : public Referee {
 private:
+    int M_half_time_count;
 
 public:
     explicit
     TimeRef( Stadium & stadium )
-        : Referee( stadium )
+        : Referee( stadium ),
+          M_half_time_count( 0 )
       { }
 
     void kickTaken( const Player &,
@@ -804,6 +807,7 @@ private:
     int M_keepers, M_takers;
     int M_time;
     int M_take_time;
+    std::time_t M_start_time;
 public:
     KeepawayRef( Stadium & stadium );
 
@@ -868,6 +872,7 @@ private:
     PVector M_prev_ball_pos;
 
     bool M_timeover;
+    bool M_first_time;
 public:
     PenaltyRef( Stadium& stadium );
 
@@ -25,21 +25,102 @@
 
 #include "remoteclient.h"
 
+#include "networkingest.h"
 #include "param.h"
+#include "shmchannel.h"
 //#include "rcssexceptions.h"
 
+#include <rcss/net/sendqueue.hpp>
 #include <rcss/net/socketstreambuf.hpp>
+#include <rcss/net/unixdatagramsocket.hpp>
 #include <rcss/gzip/gzstream.hpp>
 
+#include <vector>
 #include <cerrno>
 #include <cstring>
 
+/*!
+  \class DeferredStreamBuf
+  \brief memory stream buffer that keeps the message boundaries set by
+  sync(), so that the messages can be passed on one by one.
+ */
+class DeferredStreamBuf
+    : public std::streambuf {
+private:
+    std::vector< char > M_data;
+    std::vector< std::size_t > M_ends;
+
+public:
+    //! write the collected messages to target and forget them
+    bool replay( std::streambuf & target )
+      {
+          bool ok = true;
+          std::size_t begin = 0;
+          for ( std::size_t end : M_ends )
+          {
+              target.sputn( M_data.data() + begin, end - begin );
+              if ( target.pubsync() == -1 )
+              {
+                  ok = false;
+              }
+              begin = end;
+          }
+
+          if ( begin < M_data.size() )
+          {
+              target.sputn( M_data.data() + begin, M_data.size() - begin );
+          }
+
+          clear();
+          return ok;
+      }
+
+    void clear()
+      {
+          M_data.clear();
+          M_ends.clear();
+      }
+
+protected:
+    virtual
+    int_type overflow( int_type c = traits_type::eof() ) override
+      {
+          if ( c != traits_type::eof() )
+          {
+              M_data.push_back( traits_type::to_char_type( c ) );
+          }
+          return traits_type::not_eof( c );
+      }
+
+    virtual
+    std::streamsize xsputn( const char_type * s,
+                            std::streamsize n ) override
+      {
+          M_data.insert( M_data.end(), s, s + n );
+          return n;
+      }
+
+    virtual
+    int sync() override
+      {
+          M_ends.push_back( M_data.size() );
+          return 0;
+      }
+};
+
 
 RemoteClient::RemoteClient()
     : M_socket()
+    , M_unix_socket( false )
     , M_socket_buf( nullptr )
+    , M_send_queue( nullptr )
     , M_gz_buf( nullptr )
+    , M_shm( nullptr )
+    , M_inbox()
     , M_transport( nullptr )
+    , M_deferred_buf( nullptr )
+    , M_deferred_target( nullptr )
+    , M_deferred_state( std::ios::goodbit )
     , M_comp_level( -1 )
     , M_enforce_dedicated_port( false )
 {
@@ -50,6 +131,7 @@ RemoteClient::RemoteClient()
 RemoteClient::~RemoteClient()
 {
     close();
+    delete M_deferred_buf;
 }
 
 std::ostream &
@@ -66,15 +148,65 @@ RemoteClient::getTransport()
     }
 }
 
+void
+RemoteClient::deferOutput()
+{
+    if ( ! M_transport
+         || M_deferred_target )
+    {
+        return;
+    }
+
+    if ( ! M_deferred_buf )
+    {
+        M_deferred_buf = new DeferredStreamBuf();
+    }
+
+    // rdbuf() clears the stream state, which has to survive the switch
+    M_deferred_state = M_transport->rdstate();
+    M_deferred_target = M_transport->rdbuf( M_deferred_buf );
+}
+
+void
+RemoteClient::commitOutput()
+{
+    if ( ! M_transport
+         || ! M_deferred_target )
+    {
+        return;
+    }
+
+    M_transport->rdbuf( M_deferred_target );
+    M_transport->setstate( M_deferred_state );
+    M_deferred_target = nullptr;
+
+    if ( ! M_transport->good() )
+    {
+        // a failed stream would not have written anything
+        M_deferred_buf->clear();
+    }
+    else if ( ! M_deferred_buf->replay( *M_transport->rdbuf() ) )
+    {
+        M_transport->setstate( std::ios::badbit );
+    }
+}
+
 void
 RemoteClient::close()
 {
-    M_socket.close();
+    if ( M_send_queue
+         && M_socket->getFD() != rcss::net::Socket::INVALIDSOCKET )
+    {
+        // the descriptor may be reused as soon as it is closed
+        M_send_queue->release( M_socket->getFD() );
+    }
+    M_socket->close();
 
     if ( M_transport )
     {
         delete M_transport;
         M_transport = nullptr;
+        M_deferred_target = nullptr;
     }
 
     if ( M_gz_buf )
@@ -83,6 +215,14 @@ RemoteClient::close()
         M_gz_buf = nullptr;
     }
 
+    if ( M_shm )
+    {
+        delete M_shm;
+        M_shm = nullptr;
+    }
+
+    M_inbox.reset();
+
     if ( M_socket_buf )
     {
         delete M_socket_buf;
@@ -95,11 +235,21 @@ RemoteClient::close()
 bool
 RemoteClient::connect( const rcss::net::Addr & dest )
 {
-    if ( ! M_socket.connect( dest ) )
+    if ( dest.isUnix() != M_unix_socket )
+    {
+        // the client came in through an endpoint of the other family
+        M_unix_socket = dest.isUnix();
+        if ( open() != 0 )
+        {
+            return false;
+        }
+    }
+
+    if ( ! M_socket->connect( dest ) )
     {
         std::cerr << __FILE__ << ": " << __LINE__
                   << ": Error connecting socket" << std::endl;
-        M_socket.close();
+        M_socket->close();
         return false;
     }
     return true;
@@ -108,14 +258,40 @@ RemoteClient::connect( const rcss::net::Addr & dest )
 int
 RemoteClient::open()
 {
-    if ( M_socket.open() )
+    if ( M_transport )
+    {
+        close();
+    }
+
+    if ( M_unix_socket )
+    {
+        rcss::net::UnixDatagramSocket * socket = new rcss::net::UnixDatagramSocket();
+        M_socket.reset( socket );
+
+        // without a name, the client could not reply to this socket
+        if ( socket->isOpen()
+             && ! socket->autoBind() )
+        {
+            std::cerr << __FILE__ << ": " << __LINE__
+                      << ": Error binding socket: "
+                      << strerror( errno ) << std::endl;
+            M_socket->close();
+            return -1;
+        }
+    }
+    else
+    {
+        M_socket.reset( new rcss::net::UDPSocket() );
+    }
+
+    if ( M_socket->isOpen() )
     {
-        if ( M_socket.setNonBlocking() < 0 )
+        if ( M_socket->setNonBlocking() < 0 )
         {
             std::cerr << __FILE__ << ": " << __LINE__
                       << ": Error setting socket non-blocking: "
                       << strerror( errno ) << std::endl;
-            M_socket.close();
+            M_socket->close();
             return -1;
         }
     }
@@ -124,21 +300,97 @@ RemoteClient::open()
         std::cerr << __FILE__ << ": " << __LINE__
                   << ": Error opening socket: "
                   << strerror( errno ) << std::endl;
-        M_socket.close();
+        M_socket->close();
         return -1;
     }
 
-    M_socket_buf = new rcss::net::SocketStreamBuf( M_socket );
+    M_socket_buf = new rcss::net::SocketStreamBuf( *M_socket );
+    M_socket_buf->setSendQueue( M_send_queue );
     M_transport = new std::ostream( M_socket_buf );
     //M_transport->setLevel( M_comp_level );
     return 0;
 }
 
+void
+RemoteClient::setSendQueue( rcss::net::SendQueue * queue )
+{
+    M_send_queue = queue;
+    if ( M_socket_buf )
+    {
+        M_socket_buf->setSendQueue( queue );
+    }
+}
+
+bool
+RemoteClient::openSharedMemory( const std::string & name )
+{
+    if ( M_shm
+         || ! M_socket->isConnected() )
+    {
+        return false;
+    }
+
+    ShmChannel * shm = new ShmChannel();
+    if ( ! shm->create( name ) )
+    {
+        delete shm;
+        return false;
+    }
+
+    const std::string msg = "(shm " + name + ")";
+    send( msg.c_str(), msg.length() + 1 );
+
+    M_shm = shm;
+    M_inbox.reset();
+    if ( M_gz_buf )
+    {
+        // rebuild the compressor on top of the new transport
+        delete M_gz_buf;
+        M_gz_buf = nullptr;
+        setCompressionLevel( M_comp_level );
+    }
+    else
+    {
+        M_transport->rdbuf( M_shm );
+    }
+
+    return true;
+}
+
+void
+RemoteClient::setInbox( const std::shared_ptr< ClientInbox > & inbox )
+{
+    M_inbox = inbox;
+}
+
+void
+RemoteClient::setInputCompressionLevel( const int level )
+{
+    if ( M_inbox )
+    {
+        M_inbox->setCompressionLevel( level );
+    }
+}
+
+bool
+RemoteClient::hasQueuedInput() const
+{
+    if ( M_shm )
+    {
+        return M_shm->hasInput()
+            || M_shm->clientClosed()
+            || M_shm->broken();
+    }
+
+    return M_inbox
+        && ( ! M_inbox->empty() || M_inbox->error() != 0 );
+}
+
 int
 RemoteClient::send( const char * msg,
                     const size_t & len )
 {
-    if ( M_socket.isConnected() )
+    if ( M_socket->isConnected() )
     {
         M_transport->write( msg, len );
         M_transport->flush();
@@ -159,16 +411,76 @@ RemoteClient::send( const char * msg,
     return -1;
 }
 
+void
+RemoteClient::sendFailed( const int err )
+{
+    if ( err != ECONNREFUSED )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error sending to socket: "
+                  << strerror( err ) << std::endl;
+    }
+    close();
+}
+
 int
 RemoteClient::recv()
 {
-    if ( M_socket.isConnected() )
+    if ( M_shm )
+    {
+        char buffer[ MaxMesg + 1 ];
+
+        int ret = M_shm->read( buffer, MaxMesg );
+        if ( ret > 0 )
+        {
+            processMsg( buffer, ret );
+        }
+        else if ( M_shm->clientClosed()
+                  || M_shm->broken() )
+        {
+            close();
+        }
+        return ret;
+    }
+
+    if ( M_inbox )
+    {
+        char buffer[ MaxMesg + 1 ];
+
+        int ret = M_inbox->pop( buffer, MaxMesg );
+        if ( ret > 0 )
+        {
+            // already decompressed by the ingest thread
+            parseMsg( buffer, ret );
+        }
+        if ( ret >= 0 )
+        {
+            return ret;
+        }
+
+        // the error is only valid once every earlier message is taken
+        const int err = M_inbox->error();
+        if ( err != 0
+             && M_inbox->empty() )
+        {
+            if ( err != ECONNREFUSED )
+            {
+                std::cerr << __FILE__ << ": " << __LINE__
+                          << ": Error receiving from socket: "
+                          << strerror( err ) << std::endl;
+            }
+            close();
+        }
+        return -1;
+    }
+
+    if ( M_socket->isConnected() )
     {
-        char buffer[ MaxMesg ];
-        std::memset( &buffer, 0, sizeof( char ) * MaxMesg );
+        // one extra byte, so that the parser can null terminate the message
+        char buffer[ MaxMesg + 1 ];
 
         size_t len = MaxMesg;
-        int ret = M_socket.recv( buffer, len );
+        int ret = M_socket->recv( buffer, len );
 
         if ( ret == -1 && errno != EWOULDBLOCK )
         {
@@ -227,6 +539,16 @@ RemoteClient::processMsg( char * msg,
     }
 }
 
+std::streambuf &
+RemoteClient::outputBuffer()
+{
+    if ( M_shm )
+    {
+        return *M_shm;
+    }
+    return *M_socket_buf;
+}
+
 int
 RemoteClient::setCompressionLevel( const int level )
 {
@@ -237,14 +559,14 @@ RemoteClient::setCompressionLevel( const int level )
     {
         if ( ! M_gz_buf )
         {
-            M_gz_buf = new rcss::gz::gzstreambuf( *M_socket_buf );
+            M_gz_buf = new rcss::gz::gzstreambuf( outputBuffer() );
         }
         M_gz_buf->setLevel( level );
         M_transport->rdbuf( M_gz_buf );
     }
     else
     {
-        M_transport->rdbuf( M_socket_buf );
+        M_transport->rdbuf( &outputBuffer() );
     }
 //     if ( level < 0 )
 //     {
@@ -26,23 +26,38 @@
 
 #include <rcss/net/udpsocket.hpp>
 
+#include <string>
+#include <memory>
+
 namespace rcss {
 namespace net {
 class SocketStreamBuf;
+class SendQueue;
 }
 namespace gz {
 class gzstreambuf;
 }
 }
 
+class ShmChannel;
+class ClientInbox;
+class DeferredStreamBuf;
 
 class RemoteClient {
 
 private:
-    rcss::net::UDPSocket M_socket;
+    //! dedicated socket, of the same family as the client's address
+    std::unique_ptr< rcss::net::Socket > M_socket;
+    bool M_unix_socket;
     rcss::net::SocketStreamBuf * M_socket_buf;
+    rcss::net::SendQueue * M_send_queue;
     rcss::gz::gzstreambuf * M_gz_buf;
+    ShmChannel * M_shm; //!< set if the client uses shared memory
+    std::shared_ptr< ClientInbox > M_inbox; //!< set if the socket is read by another thread
     std::ostream * M_transport;
+    DeferredStreamBuf * M_deferred_buf; //!< collects the messages while output is deferred
+    std::streambuf * M_deferred_target; //!< set between deferOutput() and commitOutput()
+    std::ios::iostate M_deferred_state;
     int M_comp_level;
 
 #ifdef HAVE_LIBZ
@@ -66,6 +81,13 @@ public:
     int send( const char * msg,
               const size_t & len );
 
+    /*!
+      \brief close the client after a queued message could not be sent,
+      as send() does for a message sent at once
+      \param err the errno of the failed send
+     */
+    void sendFailed( const int err );
+
     int recv();
 
     void undedicatedRecv( char * msg,
@@ -87,15 +109,68 @@ public:
 
     int setCompressionLevel( const int level );
 
+    /*!
+      \brief have the input read by NetworkIngest decompressed at level.
+      Called before the client is told about the new level, so that
+      every compressed datagram is received after it.
+     */
+    void setInputCompressionLevel( const int level );
+
+    //! queue outgoing messages on queue, or send them at once if it is null
+    void setSendQueue( rcss::net::SendQueue * queue );
+
+    /*!
+      \brief move the message transport to a new shared memory segment.
+      The client is told the segment name over its socket, then all
+      further messages in both directions use the segment.
+      \return false if the segment could not be created
+     */
+    bool openSharedMemory( const std::string & name );
+
+    bool usesSharedMemory() const
+      {
+          return M_shm != nullptr;
+      }
+
+    /*!
+      \brief read messages from inbox instead of the socket. The inbox
+      is filled by NetworkIngest.
+     */
+    void setInbox( const std::shared_ptr< ClientInbox > & inbox );
+
+    //! true if the input is read from a queue instead of the socket
+    bool usesQueuedInput() const
+      {
+          return M_shm != nullptr
+              || M_inbox != nullptr;
+      }
+
+    //! true if a message or the end of the input is waiting in the queue
+    bool hasQueuedInput() const;
+
     std::ostream & getTransport();
 
+    /*!
+      \brief collect the messages written to the transport in memory
+      until commitOutput().  The messages of several clients can then be
+      built on different threads.
+     */
+    void deferOutput();
+
+    //! send the messages collected since deferOutput()
+    void commitOutput();
+
 protected:
     void close();
 
+private:
+    //! the buffer below the compressor
+    std::streambuf & outputBuffer();
+
 public:
     bool connected() const
       {
-          return M_socket.isConnected();
+          return M_socket->isConnected();
       }
 
     bool connect( const rcss::net::Addr & dest );
@@ -104,7 +179,12 @@ public:
 
     rcss::net::Addr getDest() const
       {
-          return M_socket.getDest();
+          return M_socket->getDest();
+      }
+
+    rcss::net::Socket::SocketDesc getFD() const
+      {
+          return M_socket->getFD();
       }
 
 };
@@ -23,6 +23,7 @@
 #define RCSS_SERIALIZER_H
 
 #include "types.h"
+#include "bufferwriter.h"
 
 #include <rcss/factory.hpp>
 
@@ -344,7 +345,7 @@ public:
                                 const std::string & name,
                                 const int dir ) const
       {
-          strm << " (" << name << ' ' << dir << ')';
+          BufferWriter( strm ) << " (" << name << ' ' << dir << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -352,7 +353,7 @@ public:
                                 const double & dist,
                                 const int dir ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir << ')';
+          BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -362,9 +363,9 @@ public:
                                 const double & dist_chg,
                                 const double & dir_chg ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir
-               << ' ' << dist_chg << ' ' << dir_chg
-               << ')';
+          BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir
+                               << ' ' << dist_chg << ' ' << dir_chg
+                               << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -375,10 +376,10 @@ public:
                                 const double & dir_chg,
                                 const int body_dir ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir
-               << ' ' << dist_chg << ' ' << dir_chg
-               << ' ' << body_dir
-               << ')';
+          BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir
+                               << ' ' << dist_chg << ' ' << dir_chg
+                               << ' ' << body_dir
+                               << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -390,10 +391,10 @@ public:
                                 const int body_dir,
                                 const int head_dir ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir
-               << ' ' << dist_chg << ' ' << dir_chg
-               << ' ' << body_dir << ' ' << head_dir
-               << ')';
+          BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir
+                               << ' ' << dist_chg << ' ' << dir_chg
+                               << ' ' << body_dir << ' ' << head_dir
+                               << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -402,10 +403,11 @@ public:
                                 const int dir,
                                 const bool tackling ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir;
+          BufferWriter out( strm );
+          out << " (" << name << ' ' << dist << ' ' << dir;
           if ( tackling )
-              strm << " t";
-          strm << ')';
+              out << " t";
+          out << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -415,11 +417,12 @@ public:
                                 const int point_dir,
                                 const bool tackling ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir
-               << ' ' << point_dir;
+          BufferWriter out( strm );
+          out << " (" << name << ' ' << dist << ' ' << dir
+              << ' ' << point_dir;
           if ( tackling )
-              strm << " t";
-          strm << ')';
+              out << " t";
+          out << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -432,12 +435,13 @@ public:
                                 const int head_dir,
                                 const bool tackling ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir
-               << ' ' << dist_chg << ' ' << dir_chg
-               << ' ' << body_dir << ' ' << head_dir;
+          BufferWriter out( strm );
+          out << " (" << name << ' ' << dist << ' ' << dir
+              << ' ' << dist_chg << ' ' << dir_chg
+              << ' ' << body_dir << ' ' << head_dir;
           if ( tackling )
-              strm << " t";
-          strm << ')';
+              out << " t";
+          out << ')';
       }
 
     void serializeVisualObject( std::ostream & strm,
@@ -451,13 +455,14 @@ public:
                                 const int point_dir,
                                 const bool tackling ) const
       {
-          strm << " (" << name << ' ' << dist << ' ' << dir
-               << ' ' << dist_chg << ' ' << dir_chg
-               << ' ' << body_dir << ' ' << head_dir
-               << ' ' << point_dir;
+          BufferWriter out( strm );
+          out << " (" << name << ' ' << dist << ' ' << dir
+              << ' ' << dist_chg << ' ' << dir_chg
+              << ' ' << body_dir << ' ' << head_dir
+              << ' ' << point_dir;
           if ( tackling )
-              strm << " t";
-          strm << ')';
+              out << " t";
+          out << ')';
       }
 
 
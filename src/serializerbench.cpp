@@ -0,0 +1,241 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              serializerbench.cpp
+                  Message formatting benchmark of the serializers
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+/*
+ * Formats a typical see message and sense_body message through the
+ * player serializer of the newest protocol version, whose tokens are
+ * written through rcss::BufferWriter, and the same text with plain
+ * std::ostream operator<< calls, and reports the time per message of
+ * both.  The optional argument is the number of messages.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "serializer.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int PROTOCOL_VERSION = 17;
+const int DEFAULT_MESSAGES = 200000;
+const int OBJECTS = 30;
+
+/*!
+  \struct SeenObject
+  \brief the values of one object in a see message.
+ */
+struct SeenObject {
+    std::string name_;
+    double dist_;
+    int dir_;
+    double dist_chg_;
+    double dir_chg_;
+    int body_dir_;
+    int head_dir_;
+};
+
+std::vector< SeenObject > g_objects;
+
+
+void
+makeObjects()
+{
+    for ( int i = 0; i < OBJECTS; ++i )
+    {
+        SeenObject obj;
+        obj.name_ = ( i < 22
+                      ? "f r t " + std::to_string( i )
+                      : "p \"Team\" " + std::to_string( i - 21 ) );
+        obj.dist_ = 3.7 + i * 2.13;
+        obj.dir_ = -45 + i * 3;
+        obj.dist_chg_ = -0.054 * ( i % 7 );
+        obj.dir_chg_ = 0.3 * ( i % 5 ) - 0.6;
+        obj.body_dir_ = 170 - i * 11;
+        obj.head_dir_ = -90 + i * 6;
+        g_objects.push_back( obj );
+    }
+}
+
+
+void
+writeSerializer( std::ostream & o,
+                 const rcss::SerializerPlayer & ser,
+                 const int time )
+{
+    ser.serializeVisualBegin( o, time );
+    for ( const SeenObject & obj : g_objects )
+    {
+        if ( obj.name_[0] == 'p' )
+        {
+            ser.serializeVisualObject( o, obj.name_, obj.dist_, obj.dir_,
+                                       obj.dist_chg_, obj.dir_chg_,
+                                       obj.body_dir_, obj.head_dir_ );
+        }
+        else
+        {
+            ser.serializeVisualObject( o, obj.name_, obj.dist_, obj.dir_ );
+        }
+    }
+    ser.serializeVisualEnd( o );
+
+    ser.serializeBodyBegin( o, time );
+    ser.serializeBodyViewMode( o, "high", "normal" );
+    ser.serializeBodyStamina( o, 7891.25, 0.987654321, 125000.0 );
+    ser.serializeBodyVelocity( o, 0.456, -32 );
+    ser.serializeNeckAngle( o, -90 );
+    ser.serializeBodyCounts( o, 1, 22, 333, 4444 );
+    ser.serializeBodyCounts( o, 5, 66, 777 );
+    ser.serializeNeckCount( o, 88 );
+    ser.serializeArm( o, 1, 2, 12.345, -30, 3 );
+    ser.serializeFocus( o, "l", 7, 5 );
+    ser.serializeTackle( o, 6, 7 );
+    ser.serializeCollision( o, false, false, false );
+    ser.serializeBodyEnd( o );
+}
+
+
+void
+writeStream( std::ostream & o,
+             const int time )
+{
+    o << "(see " << time;
+    for ( const SeenObject & obj : g_objects )
+    {
+        if ( obj.name_[0] == 'p' )
+        {
+            o << " (" << obj.name_ << ' ' << obj.dist_ << ' ' << obj.dir_
+              << ' ' << obj.dist_chg_ << ' ' << obj.dir_chg_
+              << ' ' << obj.body_dir_ << ' ' << obj.head_dir_ << ')';
+        }
+        else
+        {
+            o << " (" << obj.name_ << ' ' << obj.dist_ << ' ' << obj.dir_ << ')';
+        }
+    }
+    o << ')';
+
+    o << "(sense_body " << time
+      << " (view_mode " << "high" << ' ' << "normal" << ')'
+      << " (stamina " << 7891.25 << ' ' << 0.987654321 << ' ' << 125000.0 << ')'
+      << " (speed " << 0.456 << ' ' << -32 << ')'
+      << " (head_angle " << -90 << ')'
+      << " (kick " << 1 << ')' << " (dash " << 22 << ')'
+      << " (turn " << 333 << ')' << " (say " << 4444 << ')'
+      << " (catch " << 5 << ')' << " (move " << 66 << ')'
+      << " (change_view " << 777 << ')'
+      << " (turn_neck " << 88 << ')'
+      << " (arm (movable " << 1 << ") (expires " << 2 << ')'
+      << " (target " << 12.345 << ' ' << -30 << ')'
+      << " (count " << 3 << "))"
+      << " (focus (target " << "l" << ' ' << 7 << ')'
+      << " (count " << 5 << "))"
+      << " (tackle (expires " << 6 << ')'
+      << " (count " << 7 << "))"
+      << " (collision none))";
+}
+
+
+template < typename W >
+double
+measure( const int messages,
+         std::string & text,
+         W write )
+{
+    std::ostringstream o;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for ( int i = 0; i < messages; ++i )
+    {
+        o.str( std::string() );
+        write( o, i );
+    }
+    const std::chrono::steady_clock::duration d = std::chrono::steady_clock::now() - start;
+
+    text = o.str();
+    typedef std::chrono::duration< double, std::nano > Nsec;
+    return std::chrono::duration_cast< Nsec >( d ).count() / messages;
+}
+
+}
+
+int
+main( int argc, char *argv[] )
+{
+    std::locale::global( std::locale::classic() );
+
+    const int messages = ( argc > 1 ? std::atoi( argv[1] ) : DEFAULT_MESSAGES );
+    if ( messages <= 0 )
+    {
+        std::cerr << "usage: " << argv[0] << " [messages]" << std::endl;
+        return 1;
+    }
+
+    rcss::SerializerPlayer::Creator creator;
+    if ( ! rcss::SerializerPlayer::factory().getCreator( creator, PROTOCOL_VERSION ) )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": No SerializerPlayer v" << PROTOCOL_VERSION << std::endl;
+        return 1;
+    }
+    const rcss::SerializerPlayer::Ptr ser = creator();
+
+    makeObjects();
+
+    std::string serializer_text;
+    std::string stream_text;
+    const double serializer_nsec
+        = measure( messages, serializer_text,
+                   [&]( std::ostream & o, const int time )
+                   {
+                       writeSerializer( o, *ser, time );
+                   } );
+    const double stream_nsec
+        = measure( messages, stream_text,
+                   []( std::ostream & o, const int time )
+                   {
+                       writeStream( o, time );
+                   } );
+
+    if ( serializer_text != stream_text )
+    {
+        std::cerr << "the messages differ:\n"
+                  << serializer_text << '\n'
+                  << stream_text << std::endl;
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision( 1 )
+              << messages << " messages of " << serializer_text.length() << " bytes"
+              << ", serializer " << serializer_nsec << " ns"
+              << ", std::ostream " << stream_nsec << " ns"
+              << std::endl;
+
+    return 0;
+}
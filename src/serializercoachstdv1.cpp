@@ -24,6 +24,8 @@
 #endif
 
 #include "serializercoachstdv1.h"
+
+#include "bufferwriter.h"
 #include "param.h"
 #include "object.h"
 
@@ -47,8 +49,8 @@ SerializerCoachStdv1::serializeRefereeAudio( std::ostream & strm,
                                              const int time,
                                              const char * msg ) const
 {
-    strm << "(hear " << REFEREE_NAME << ' ' << time
-         << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << REFEREE_NAME << ' ' << time
+                         << ' ' << msg << ')';
 }
 
 void
@@ -57,8 +59,8 @@ SerializerCoachStdv1::serializeCoachAudio( std::ostream & strm,
                                            const std::string & name,
                                            const char * msg ) const
 {
-    strm << "(hear " << name << ' ' << time
-         << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << name << ' ' << time
+                         << ' ' << msg << ')';
 }
 
 void
@@ -77,14 +79,14 @@ SerializerCoachStdv1::serializePlayerAudio( std::ostream & strm,
                                             const std::string & name,
                                             const char * msg ) const
 {
-    strm << "(hear " << name << ' ' << time
-         << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << name << ' ' << time
+                         << ' ' << msg << ')';
 }
 
 void
 SerializerCoachStdv1::serializeInit( std::ostream & strm ) const
 {
-    strm << "(init ok)";
+    BufferWriter( strm ) << "(init ok)";
 }
 
 
@@ -92,14 +94,14 @@ void
 SerializerCoachStdv1::serializeVisualBegin( std::ostream & strm,
                                             const int time ) const
 {
-    strm << "(see " << time;
+    BufferWriter( strm ) << "(see " << time;
 }
 
 
 void
 SerializerCoachStdv1::serializeVisualEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
@@ -107,13 +109,13 @@ void
 SerializerCoachStdv1::serializeLookBegin( std::ostream & strm,
                                           const int time ) const
 {
-    strm << "(ok look " << time;
+    BufferWriter( strm ) << "(ok look " << time;
 }
 
 void
 SerializerCoachStdv1::serializeLookEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -121,7 +123,7 @@ SerializerCoachStdv1::serializeVisualObject( std::ostream & strm,
                                              const std::string & name,
                                              const PVector & pos ) const
 {
-    strm << " (" << name << ' ' << pos.x << ' ' << pos.y << ')';
+    BufferWriter( strm ) << " (" << name << ' ' << pos.x << ' ' << pos.y << ')';
 }
 
 void
@@ -130,10 +132,10 @@ SerializerCoachStdv1::serializeVisualObject( std::ostream & strm,
                                              const PVector & pos,
                                              const PVector & vel ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ')';
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ')';
 }
 
 
@@ -145,12 +147,12 @@ SerializerCoachStdv1::serializeVisualObject( std::ostream & strm,
                                              const int body,
                                              const int neck ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << body
-         << ' ' << neck
-         << ' ' << vel.x << ' ' << vel.y
-         << ')';
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ')';
 }
 
 
@@ -163,12 +165,12 @@ SerializerCoachStdv1::serializeVisualPlayer( std::ostream & strm,
                                              const int body,
                                              const int neck ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << body
-         << ' ' << neck
-         << ' ' << vel.x << ' ' << vel.y
-         << ')';
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ')';
 }
 
  void
@@ -181,12 +183,12 @@ SerializerCoachStdv1::serializeVisualPlayer( std::ostream & strm,
                                               const int neck,
                                               const int /*point_dir*/ ) const
  {
-     strm << " (" << name
-          << ' ' << pos.x << ' ' << pos.y
-          << ' ' << body
-          << ' ' << neck
-          << ' ' << vel.x << ' ' << vel.y
-          << ')';
+     BufferWriter( strm ) << " (" << name
+                          << ' ' << pos.x << ' ' << pos.y
+                          << ' ' << body
+                          << ' ' << neck
+                          << ' ' << vel.x << ' ' << vel.y
+                          << ')';
  }
 
 
@@ -194,9 +196,9 @@ void
 SerializerCoachStdv1::serializeOKEye( std::ostream & strm,
                                       const bool on ) const
 {
-    strm << "(ok eye "
-         << ( on ? "on" : "off" )
-         << ')';
+    BufferWriter( strm ) << "(ok eye "
+                         << ( on ? "on" : "off" )
+                         << ')';
 }
 
 
@@ -25,6 +25,7 @@
 
 #include "serializercoachstdv13.h"
 
+#include "bufferwriter.h"
 #include "player.h"
 
 namespace rcss {
@@ -50,20 +51,20 @@ SerializerCoachStdv13::serializeVisualPlayer( std::ostream & strm,
                                              const int body,
                                              const int neck ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -76,21 +77,21 @@ SerializerCoachStdv13::serializeVisualPlayer( std::ostream & strm,
                                              const int neck,
                                              const int point_dir ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck
-         << ' ' << point_dir;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ' ' << point_dir;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
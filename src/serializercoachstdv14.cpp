@@ -25,6 +25,7 @@
 
 #include "serializercoachstdv14.h"
 
+#include "bufferwriter.h"
 #include "player.h"
 
 namespace rcss {
@@ -50,34 +51,34 @@ SerializerCoachStdv14::serializeVisualPlayer( std::ostream & strm,
                                              const int body,
                                              const int neck ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
     else if ( player.foulCycles() > 0 )
     {
-        strm << " f";
+        BufferWriter( strm ) << " f";
     }
 
     if ( player.hasRedCard() )
     {
-        strm << " r";
+        BufferWriter( strm ) << " r";
     }
     else if ( player.hasYellowCard() )
     {
-        strm << " y";
+        BufferWriter( strm ) << " y";
     }
 
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -90,31 +91,31 @@ SerializerCoachStdv14::serializeVisualPlayer( std::ostream & strm,
                                              const int neck,
                                              const int point_dir ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck
-         << ' ' << point_dir;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ' ' << point_dir;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
 
     if ( player.hasRedCard() )
     {
-        strm << " r";
+        BufferWriter( strm ) << " r";
     }
     else if ( player.hasYellowCard() )
     {
-        strm << " y";
+        BufferWriter( strm ) << " y";
     }
 
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
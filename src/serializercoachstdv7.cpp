@@ -25,6 +25,7 @@
 
 #include "serializercoachstdv7.h"
 
+#include "bufferwriter.h"
 #include "object.h"
 
 #include <rcss/clang/clangmsg.h>
@@ -48,8 +49,8 @@ SerializerCoachStdv7::serializeCoachAudio( std::ostream & strm,
                                            const std::string & name,
                                            const char * msg ) const
 {
-    strm << "(hear " << time << ' ' << name
-         << " \"" << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << ' ' << name
+                         << " \"" << msg << "\")";
 }
 
 void
@@ -68,8 +69,8 @@ SerializerCoachStdv7::serializePlayerAudio( std::ostream & strm,
                                             const std::string & name,
                                             const char * msg ) const
 {
-    strm << "(hear " << time << ' ' << name
-         << " \"" << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << ' ' << name
+                         << " \"" << msg << "\")";
 }
 
 
@@ -77,7 +78,7 @@ void
 SerializerCoachStdv7::serializeVisualBegin( std::ostream & strm,
                                             const int time ) const
 {
-    strm << "(see_global " << time;
+    BufferWriter( strm ) << "(see_global " << time;
 }
 
 
@@ -89,12 +90,12 @@ SerializerCoachStdv7::serializeVisualObject( std::ostream & strm,
                                              const int body,
                                              const int neck ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck
-         << ')';
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ')';
 }
 
 void
@@ -106,12 +107,12 @@ SerializerCoachStdv7::serializeVisualPlayer( std::ostream & strm,
                                              const int body,
                                              const int neck ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck
-         << ')';
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ')';
 }
 
 void
@@ -124,12 +125,12 @@ SerializerCoachStdv7::serializeVisualPlayer( std::ostream & strm,
                                              const int neck,
                                              const int /*point_dir*/ ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck
-         << ')';
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ')';
 }
 
 
@@ -25,6 +25,7 @@
 
 #include "serializercoachstdv8.h"
 
+#include "bufferwriter.h"
 #include "object.h"
 #include "player.h"
 
@@ -52,16 +53,16 @@ SerializerCoachStdv8::serializeVisualObject( std::ostream & strm,
                                              const int neck,
                                              const bool tackling ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck;
     if ( tackling )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -74,17 +75,17 @@ SerializerCoachStdv8::serializeVisualObject( std::ostream & strm,
                                              const int point_dir,
                                              const bool tackling ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck
-         << ' ' << point_dir;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ' ' << point_dir;
     if ( tackling )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -96,16 +97,16 @@ SerializerCoachStdv8::serializeVisualPlayer( std::ostream & strm,
                                              const int body,
                                              const int neck ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -118,17 +119,17 @@ SerializerCoachStdv8::serializeVisualPlayer( std::ostream & strm,
                                              const int neck,
                                              const int point_dir ) const
 {
-    strm << " (" << name
-         << ' ' << pos.x << ' ' << pos.y
-         << ' ' << vel.x << ' ' << vel.y
-         << ' ' << body
-         << ' ' << neck
-         << ' ' << point_dir;
+    BufferWriter( strm ) << " (" << name
+                         << ' ' << pos.x << ' ' << pos.y
+                         << ' ' << vel.x << ' ' << vel.y
+                         << ' ' << body
+                         << ' ' << neck
+                         << ' ' << point_dir;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
@@ -25,6 +25,8 @@
 
 #include "serializercommonstdv7.h"
 
+#include "bufferwriter.h"
+
 #include <rcss/clang/clangmsg.h>
 
 namespace rcss {
@@ -42,73 +44,73 @@ SerializerCommonStdv7::~SerializerCommonStdv7()
 void
 SerializerCommonStdv7::serializeServerParamBegin( std::ostream & strm ) const
 {
-    strm << "(server_param";
+    BufferWriter( strm ) << "(server_param";
 }
 
 void
 SerializerCommonStdv7::serializeServerParamEnd( std::ostream & strm ) const
 {
-    strm << ")";
+    BufferWriter( strm ) << ")";
 }
 
 void
 SerializerCommonStdv7::serializePlayerParamBegin( std::ostream & strm ) const
 {
-    strm << "(player_param";
+    BufferWriter( strm ) << "(player_param";
 }
 
 void
 SerializerCommonStdv7::serializePlayerParamEnd( std::ostream & strm ) const
 {
-    strm << ")";
+    BufferWriter( strm ) << ")";
 }
 
 void
 SerializerCommonStdv7::serializePlayerTypeBegin( std::ostream & strm,
                                                  const int id ) const
 {
-    strm << "(player_type " << id;
+    BufferWriter( strm ) << "(player_type " << id;
 }
 
 void
 SerializerCommonStdv7::serializePlayerTypeEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
 SerializerCommonStdv7::serializeParam( std::ostream & strm,
                                        const int param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerCommonStdv7::serializeParam( std::ostream & strm,
                                        const unsigned int param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerCommonStdv7::serializeParam( std::ostream & strm,
                                        const bool param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerCommonStdv7::serializeParam( std::ostream & strm,
                                        const double & param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerCommonStdv7::serializeParam( std::ostream & strm,
                                        const std::string & param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 const
@@ -25,6 +25,8 @@
 
 #include "serializercommonstdv8.h"
 
+#include "bufferwriter.h"
+
 //#include "clangmsg.h"
 
 namespace rcss {
@@ -42,21 +44,21 @@ SerializerCommonStdv8::~SerializerCommonStdv8()
 void
 SerializerCommonStdv8::serializeServerParamBegin( std::ostream & strm ) const
 {
-    strm << "(server_param ";
+    BufferWriter( strm ) << "(server_param ";
 }
 
 void
 SerializerCommonStdv8::serializePlayerParamBegin( std::ostream & strm ) const
 {
-    strm << "(player_param ";
+    BufferWriter( strm ) << "(player_param ";
 }
 
 void
 SerializerCommonStdv8::serializePlayerTypeBegin( std::ostream & strm,
                                                  const int id ) const
 {
-    strm << "(player_type "
-         << "(id " << id << ")";
+    BufferWriter( strm ) << "(player_type "
+                         << "(id " << id << ")";
 }
 
 void
@@ -64,7 +66,7 @@ SerializerCommonStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const int param ) const
 {
-    strm << "(" << name << ' ' << param << ')';
+    BufferWriter( strm ) << "(" << name << ' ' << param << ')';
 }
 
 void
@@ -72,7 +74,7 @@ SerializerCommonStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const bool param ) const
 {
-    strm << "(" << name << ' ' << param << ')';
+    BufferWriter( strm ) << "(" << name << ' ' << param << ')';
 }
 
 void
@@ -80,7 +82,7 @@ SerializerCommonStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const double & param ) const
 {
-    strm << "(" << name << ' ' << param << ')';
+    BufferWriter( strm ) << "(" << name << ' ' << param << ')';
 }
 
 void
@@ -88,7 +90,7 @@ SerializerCommonStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const std::string & param ) const
 {
-    strm << "(" << name << " \"" << param << "\")";
+    BufferWriter( strm ) << "(" << name << " \"" << param << "\")";
 }
 
 const
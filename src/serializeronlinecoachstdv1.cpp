@@ -25,6 +25,8 @@
 
 #include "serializeronlinecoachstdv1.h"
 
+#include "bufferwriter.h"
+
 namespace rcss {
 
 SerializerOnlineCoachStdv1::SerializerOnlineCoachStdv1( const SerializerCommon::Ptr common,
@@ -45,8 +47,8 @@ SerializerOnlineCoachStdv1::serializeRefereeAudio( std::ostream & strm,
                                                    const std::string & name,
                                                    const char* msg ) const
 {
-    strm << "(hear " << time << ' ' << name
-         << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << time << ' ' << name
+                         << ' ' << msg << ')';
 }
 
 void
@@ -55,8 +57,8 @@ SerializerOnlineCoachStdv1::serializePlayerAudio( std::ostream & strm,
                                                   const std::string & name,
                                                   const char * msg ) const
 {
-    strm << "(hear " << time << ' ' << name << ' '
-         << msg << ')';
+    BufferWriter( strm ) << "(hear " << time << ' ' << name << ' '
+                         << msg << ')';
 }
 
 void
@@ -72,7 +74,7 @@ void
 SerializerOnlineCoachStdv1::serializeInit( std::ostream & strm,
                                            const int ) const
 {
-    strm << "(init ok)";
+    BufferWriter( strm ) << "(init ok)";
 }
 
 void
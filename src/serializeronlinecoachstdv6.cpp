@@ -25,6 +25,8 @@
 
 #include "serializeronlinecoachstdv6.h"
 
+#include "bufferwriter.h"
+
 namespace rcss {
 
 SerializerOnlineCoachStdv6::SerializerOnlineCoachStdv6( const SerializerCommon::Ptr common,
@@ -43,9 +45,9 @@ void
 SerializerOnlineCoachStdv6::serializeInit( std::ostream& strm,
                                            const int side ) const
 {
-    strm << "(init "
-         << ( side == LEFT ? 'l' : 'r' )
-         << " ok)";
+    BufferWriter( strm ) << "(init "
+                         << ( side == LEFT ? 'l' : 'r' )
+                         << " ok)";
 }
 
 const
@@ -25,6 +25,8 @@
 
 #include "serializeronlinecoachstdv7.h"
 
+#include "bufferwriter.h"
+
 namespace rcss {
 
 SerializerOnlineCoachStdv7::SerializerOnlineCoachStdv7( const SerializerCommon::Ptr common,
@@ -45,8 +47,8 @@ SerializerOnlineCoachStdv7::serializeRefereeAudio( std::ostream & strm,
                                                    const std::string & name,
                                                    const char * msg ) const
 {
-    strm << "(hear " << time << ' ' << name
-         << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << time << ' ' << name
+                         << ' ' << msg << ')';
 }
 
 void
@@ -55,8 +57,8 @@ SerializerOnlineCoachStdv7::serializePlayerAudio( std::ostream & strm,
                                                   const std::string & name,
                                                   const char * msg ) const
 {
-    strm << "(hear " << time << ' ' << name << " \""
-         << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << ' ' << name << " \""
+                         << msg << "\")";
 }
 
 void
@@ -64,10 +66,11 @@ SerializerOnlineCoachStdv7::serializeChangedPlayer( std::ostream & strm,
                                                     const int unum,
                                                     const int type ) const
 {
-    strm << "(change_player_type " << unum;
+    BufferWriter out( strm );
+    out << "(change_player_type " << unum;
     if ( type >= 0 )
-        strm << ' ' << type;
-    strm << ')';
+        out << ' ' << type;
+    out << ')';
 }
 
 const
@@ -25,6 +25,8 @@
 
 #include "serializeronlinecoachstdv8.h"
 
+#include "bufferwriter.h"
+
 namespace rcss {
 
 SerializerOnlineCoachStdv8::SerializerOnlineCoachStdv8( const SerializerCommon::Ptr common,
@@ -45,7 +47,7 @@ SerializerOnlineCoachStdv8::serializePlayerClangVer( std::ostream& strm,
                                                      const unsigned int min,
                                                      const unsigned int max ) const
 {
-    strm << "(clang (ver " << name << ' ' << min << ' ' << max << "))";
+    BufferWriter( strm ) << "(clang (ver " << name << ' ' << min << ' ' << max << "))";
 }
 
 
@@ -25,6 +25,7 @@
 
 #include "serializerplayerstdv1.h"
 
+#include "bufferwriter.h"
 #include "param.h"
 
 #include <rcss/clang/clangmsg.h>
@@ -49,8 +50,8 @@ SerializerPlayerStdv1::serializeRefereeAudio( std::ostream & strm,
                                               const int time,
                                               const char * msg ) const
 {
-    strm << "(hear " << time << ' '
-         << REFEREE_NAME << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << time << ' '
+                         << REFEREE_NAME << ' ' << msg << ')';
 }
 
 void
@@ -59,8 +60,8 @@ SerializerPlayerStdv1::serializeCoachAudio( std::ostream & strm,
                                             const std::string & name,
                                             const char * msg ) const
 {
-    strm << "(hear " << time << ' '
-         << name << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << time << ' '
+                         << name << ' ' << msg << ')';
 }
 
 void
@@ -78,8 +79,8 @@ SerializerPlayerStdv1::serializeSelfAudio( std::ostream & strm,
                                            const int time,
                                            const char * msg ) const
 {
-    strm << "(hear " << time << " self "
-         << msg << ')';
+    BufferWriter( strm ) << "(hear " << time << " self "
+                         << msg << ')';
 }
 
 void
@@ -88,34 +89,34 @@ SerializerPlayerStdv1::serializePlayerAudio( std::ostream & strm,
                                              const double & dir,
                                              const char * msg ) const
 {
-    strm << "(hear " << time << ' '
-         << dir << ' ' << msg << ')';
+    BufferWriter( strm ) << "(hear " << time << ' '
+                         << dir << ' ' << msg << ')';
 }
 
 void
 SerializerPlayerStdv1::serializeVisualBegin( std::ostream & strm,
                                              const int time ) const
 {
-    strm << "(see " << time;
+    BufferWriter( strm ) << "(see " << time;
 }
 
 void
 SerializerPlayerStdv1::serializeVisualEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
 SerializerPlayerStdv1::serializeBodyBegin( std::ostream & strm,
                                            const int time ) const
 {
-    strm << "(sense_body " << time;
+    BufferWriter( strm ) << "(sense_body " << time;
 }
 
 void
 SerializerPlayerStdv1::serializeBodyEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -123,7 +124,7 @@ SerializerPlayerStdv1::serializeBodyViewMode( std::ostream & strm,
                                               const char* qual,
                                               const char* width ) const
 {
-    strm << " (view_mode " << qual << ' ' << width << ')';
+    BufferWriter( strm ) << " (view_mode " << qual << ' ' << width << ')';
 }
 
 void
@@ -132,14 +133,14 @@ SerializerPlayerStdv1::serializeBodyStamina( std::ostream & strm,
                                              const double & effort,
                                              const double & /*stamina_capacity*/ ) const
 {
-    strm << " (stamina " << stamina << ' ' << effort << ')';
+    BufferWriter( strm ) << " (stamina " << stamina << ' ' << effort << ')';
 }
 
 void
 SerializerPlayerStdv1::serializeBodyVelocity( std::ostream & strm,
                                               const double & mag ) const
 {
-    strm << " (speed " << mag << ')';
+    BufferWriter( strm ) << " (speed " << mag << ')';
 }
 
 void
@@ -147,7 +148,7 @@ SerializerPlayerStdv1::serializeBodyVelocity( std::ostream & strm,
                                               const double & mag,
                                               const int head ) const
 {
-    strm << " (speed " << mag << ' ' << head << ')';
+    BufferWriter( strm ) << " (speed " << mag << ' ' << head << ')';
 }
 
 void
@@ -157,10 +158,10 @@ SerializerPlayerStdv1::serializeBodyCounts( std::ostream & strm,
                                             const int count_turn,
                                             const int count_say ) const
 {
-    strm << " (kick " << count_kick << ')'
-         << " (dash " << count_dash << ')'
-         << " (turn " << count_turn << ')'
-         << " (say " << count_say << ')';
+    BufferWriter( strm ) << " (kick " << count_kick << ')'
+                         << " (dash " << count_dash << ')'
+                         << " (turn " << count_turn << ')'
+                         << " (say " << count_say << ')';
 }
 
 void
@@ -169,23 +170,23 @@ SerializerPlayerStdv1::serializeBodyCounts( std::ostream & strm,
                                             const int count_move,
                                             const int count_change_view ) const
 {
-    strm << " (catch " << count_catch << ')'
-         << " (move " << count_move << ')'
-         << " (change_view " << count_change_view << ')';
+    BufferWriter( strm ) << " (catch " << count_catch << ')'
+                         << " (move " << count_move << ')'
+                         << " (change_view " << count_change_view << ')';
 }
 
 void
 SerializerPlayerStdv1::serializeNeckAngle( std::ostream & strm,
                                            const int ang ) const
 {
-    strm << " (head_angle " << ang << ')';
+    BufferWriter( strm ) << " (head_angle " << ang << ')';
 }
 
 void
 SerializerPlayerStdv1::serializeNeckCount( std::ostream & strm,
                                            const int count_turn_neck ) const
 {
-    strm << " (turn_neck " << count_turn_neck << ')';
+    BufferWriter( strm ) << " (turn_neck " << count_turn_neck << ')';
 }
 
 void
@@ -196,12 +197,12 @@ SerializerPlayerStdv1::serializeArm( std::ostream & strm,
                                      const int head,
                                      const int count ) const
 {
-    strm << " (arm"
-         << " (movable " << movable_cycles << ')'
-         << " (expires " << expires_cycles << ')'
-         << " (target " << dist << ' ' << head << ')'
-         << " (count " << count << ')'
-         << ')';
+    BufferWriter( strm ) << " (arm"
+                         << " (movable " << movable_cycles << ')'
+                         << " (expires " << expires_cycles << ')'
+                         << " (target " << dist << ' ' << head << ')'
+                         << " (count " << count << ')'
+                         << ')';
 }
 
 void
@@ -209,10 +210,10 @@ SerializerPlayerStdv1::serializeFocus( std::ostream & strm,
                                        const char* name,
                                        const int count ) const
 {
-    strm << " (focus"
-         << " (target " << name << ')'
-         << " (count " << count << ')'
-         << ')';
+    BufferWriter( strm ) << " (focus"
+                         << " (target " << name << ')'
+                         << " (count " << count << ')'
+                         << ')';
 }
 
 void
@@ -221,10 +222,10 @@ SerializerPlayerStdv1::serializeFocus( std::ostream & strm,
                                        const int unum,
                                        const int count ) const
 {
-    strm << " (focus"
-         << " (target " << team << ' ' << unum << ')'
-         << " (count " << count << ')'
-         << ')';
+    BufferWriter( strm ) << " (focus"
+                         << " (target " << team << ' ' << unum << ')'
+                         << " (count " << count << ')'
+                         << ')';
 }
 
 
@@ -233,10 +234,10 @@ SerializerPlayerStdv1::serializeTackle( std::ostream & strm,
                                         const int cycles,
                                         const int count ) const
 {
-    strm << " (tackle"
-         << " (expires " << cycles << ')'
-         << " (count " << count << ')'
-         << ')';
+    BufferWriter( strm ) << " (tackle"
+                         << " (expires " << cycles << ')'
+                         << " (count " << count << ')'
+                         << ')';
 }
 
 void
@@ -247,32 +248,32 @@ SerializerPlayerStdv1::serializeCollision( std::ostream & strm,
 {
     bool collide = false;
 
-    strm << " (collision";
+    BufferWriter( strm ) << " (collision";
 
     if ( ball_collide )
     {
         collide = true;
-        strm << " (ball)";
+        BufferWriter( strm ) << " (ball)";
     }
 
     if ( player_collide )
     {
         collide = true;
-        strm << " (player)";
+        BufferWriter( strm ) << " (player)";
     }
 
     if ( post_collide )
     {
         collide = true;
-        strm << " (post)";
+        BufferWriter( strm ) << " (post)";
     }
 
     if ( ! collide )
     {
-        strm << " none";
+        BufferWriter( strm ) << " none";
     }
 
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -280,13 +281,13 @@ SerializerPlayerStdv1::serializeFSBegin( std::ostream & strm,
                                          const int time ) const
 {
     strm.precision( 6 );
-    strm << "(fullstate " << time;
+    BufferWriter( strm ) << "(fullstate " << time;
 }
 
 void
 SerializerPlayerStdv1::serializeFSEnd( std::ostream & strm) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -294,14 +295,14 @@ SerializerPlayerStdv1::serializeFSViewMode( std::ostream & strm,
                                             const char* qual,
                                             const char* width ) const
 {
-    strm << " (vmode " << qual << ' ' << width << ')';
+    BufferWriter( strm ) << " (vmode " << qual << ' ' << width << ')';
 }
 
 void
 SerializerPlayerStdv1::serializeFSPlayMode( std::ostream & strm,
                                             const char* mode ) const
 {
-    strm << " (pmode " << mode << ')';
+    BufferWriter( strm ) << " (pmode " << mode << ')';
 }
 
 // caution: in version 5 left is the points for the left team
@@ -313,7 +314,7 @@ SerializerPlayerStdv1::serializeFSScore( std::ostream & strm,
                                          const int left,
                                          const int right ) const
 {
-    strm << " (score " << left << ' ' << right << ')';
+    BufferWriter( strm ) << " (score " << left << ' ' << right << ')';
 }
 
 
@@ -324,12 +325,12 @@ SerializerPlayerStdv1::serializeFSBall( std::ostream & strm,
                                         const double & vel_x,
                                         const double & vel_y ) const
 {
-    strm << " (ball"
-         << ' ' << x
-         << ' ' << y
-         << ' ' << vel_x
-         << ' ' << vel_y
-         << ')';
+    BufferWriter( strm ) << " (ball"
+                         << ' ' << x
+                         << ' ' << y
+                         << ' ' << vel_x
+                         << ' ' << vel_y
+                         << ')';
 }
 
 void
@@ -346,13 +347,13 @@ SerializerPlayerStdv1::serializeFSPlayerBegin( std::ostream & strm,
                                                const double & neck_dir ) const
 
 {
-    strm << " (" << side << "_" << unum
-         << ' ' << x
-         << ' ' << y
-         << ' ' << vel_x
-         << ' ' << vel_y
-         << ' ' << body_dir
-         << ' ' << neck_dir;
+    BufferWriter( strm ) << " (" << side << "_" << unum
+                         << ' ' << x
+                         << ' ' << y
+                         << ' ' << vel_x
+                         << ' ' << vel_y
+                         << ' ' << body_dir
+                         << ' ' << neck_dir;
 }
 
 void
@@ -362,15 +363,15 @@ SerializerPlayerStdv1::serializeFSPlayerStamina( std::ostream & strm,
                                                  const double & recovery,
                                                  const double & /*stamina_capacity*/ ) const
 {
-    strm << ' ' << stamina
-         << ' ' << effort
-         << ' ' << recovery;
+    BufferWriter( strm ) << ' ' << stamina
+                         << ' ' << effort
+                         << ' ' << recovery;
 }
 
 void
 SerializerPlayerStdv1::serializeFSPlayerEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
@@ -380,8 +381,8 @@ SerializerPlayerStdv1::serializeInit( std::ostream & strm,
                                       const int unum,
                                       const PlayMode & mode ) const
 {
-    strm << "(init " << side << ' ' << unum << ' '
-         << playmode_strings[ mode ] << ')';
+    BufferWriter( strm ) << "(init " << side << ' ' << unum << ' '
+                         << playmode_strings[ mode ] << ')';
 }
 
 void
@@ -389,8 +390,8 @@ SerializerPlayerStdv1::serializeReconnect( std::ostream & strm,
                                            const char * side,
                                            const PlayMode & mode ) const
 {
-    strm << "(reconnect " << side << ' '
-         << playmode_strings[ mode ] << ')';
+    BufferWriter( strm ) << "(reconnect " << side << ' '
+                         << playmode_strings[ mode ] << ')';
 }
 
 void
@@ -398,14 +399,14 @@ SerializerPlayerStdv1::serializeOKClang( std::ostream & strm,
                                          const int min,
                                          const int max ) const
 {
-    strm << "(ok clang (ver " << min << ' ' << max << "))";
+    BufferWriter( strm ) << "(ok clang (ver " << min << ' ' << max << "))";
 }
 
 void
 SerializerPlayerStdv1::serializeErrorNoTeamName( std::ostream & strm,
                                                  const std::string & team_name ) const
 {
-    strm << "(error no team with name " << team_name << ')';
+    BufferWriter( strm ) << "(error no team with name " << team_name << ')';
 }
 
 void
@@ -414,7 +415,7 @@ SerializerPlayerStdv1::serializeScore( std::ostream & strm,
                                        const int our,
                                        const int opp ) const
 {
-    strm << "(score " << time << ' ' << our << ' ' << opp << ')';
+    BufferWriter( strm ) << "(score " << time << ' ' << our << ' ' << opp << ')';
 }
 
 
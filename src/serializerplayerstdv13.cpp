@@ -25,6 +25,7 @@
 
 #include "serializerplayerstdv13.h"
 
+#include "bufferwriter.h"
 #include "player.h"
 
 namespace rcss {
@@ -48,16 +49,16 @@ SerializerPlayerStdv13::serializeVisualPlayer( std::ostream & strm,
                                                const double & dist,
                                                const int dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir;
+    BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
@@ -69,17 +70,17 @@ SerializerPlayerStdv13::serializeVisualPlayer( std::ostream & strm,
                                                const int dir,
                                                const int point_dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir
-         << ' ' << point_dir;
+    BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir
+                         << ' ' << point_dir;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
@@ -94,18 +95,18 @@ SerializerPlayerStdv13::serializeVisualPlayer( std::ostream & strm,
                                                const int body_dir,
                                                const int head_dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir
-         << ' ' << dist_chg << ' ' << dir_chg
-         << ' ' << body_dir << ' ' << head_dir;
+    BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir
+                         << ' ' << dist_chg << ' ' << dir_chg
+                         << ' ' << body_dir << ' ' << head_dir;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
@@ -121,19 +122,19 @@ SerializerPlayerStdv13::serializeVisualPlayer( std::ostream & strm,
                                                const int head_dir,
                                                const int point_dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir
-         << ' ' << dist_chg << ' ' << dir_chg
-         << ' ' << body_dir << ' ' << head_dir
-         << ' ' << point_dir;
+    BufferWriter( strm ) << " (" << name << ' ' << dist << ' ' << dir
+                         << ' ' << dist_chg << ' ' << dir_chg
+                         << ' ' << body_dir << ' ' << head_dir
+                         << ' ' << point_dir;
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 
@@ -143,10 +144,10 @@ SerializerPlayerStdv13::serializeBodyStamina( std::ostream & strm,
                                               const double & effort,
                                               const double & stamina_capacity ) const
 {
-    strm << " (stamina "
-         << stamina << ' '
-         << effort << ' '
-         << stamina_capacity << ')';
+    BufferWriter( strm ) << " (stamina "
+                         << stamina << ' '
+                         << effort << ' '
+                         << stamina_capacity << ')';
 }
 
 void
@@ -156,11 +157,11 @@ SerializerPlayerStdv13::serializeFSPlayerStamina( std::ostream & strm,
                                                   const double & recovery,
                                                   const double & stamina_capacity ) const
 {
-    strm << " (stamina " << stamina
-         << ' ' << effort
-         << ' ' << recovery
-         << ' ' << stamina_capacity
-         << ')';
+    BufferWriter( strm ) << " (stamina " << stamina
+                         << ' ' << effort
+                         << ' ' << recovery
+                         << ' ' << stamina_capacity
+                         << ')';
 }
 
 void
@@ -169,11 +170,11 @@ SerializerPlayerStdv13::serializeFSPlayerState( std::ostream & strm,
 {
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
 }
 
@@ -25,6 +25,7 @@
 
 #include "serializerplayerstdv14.h"
 
+#include "bufferwriter.h"
 #include "player.h"
 
 namespace rcss {
@@ -44,24 +45,24 @@ void
 SerializerPlayerStdv14::serializeFoul( std::ostream & strm,
                                        const Player & self ) const
 {
-    strm << " (foul "
-         << " (charged " << self.foulCycles() << ')';
+    BufferWriter( strm ) << " (foul "
+                         << " (charged " << self.foulCycles() << ')';
 
     if ( self.hasRedCard() )
     {
-        strm << " (card red)";
+        BufferWriter( strm ) << " (card red)";
     }
     else if ( self.hasYellowCard() )
     {
-        strm << " (card yellow)";
+        BufferWriter( strm ) << " (card yellow)";
 
     }
     else
     {
-        strm << " (card none)";
+        BufferWriter( strm ) << " (card none)";
     }
 
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
@@ -78,21 +79,21 @@ SerializerPlayerStdv14::serializeFSPlayerBegin( std::ostream & strm,
                                                 const double & neck_dir ) const
 
 {
-    strm << " ((p " << side
-         << ' ' << unum;
+    BufferWriter( strm ) << " ((p " << side
+                         << ' ' << unum;
 
     if ( goalie )
     {
-        strm << " g";
+        BufferWriter( strm ) << " g";
     }
 
-    strm << ' ' << type // hetro player type
-         << ") " << x
-         << ' ' << y
-         << ' ' << vel_x
-         << ' ' << vel_y
-         << ' ' << body_dir
-         << ' ' << neck_dir;
+    BufferWriter( strm ) << ' ' << type // hetro player type
+                         << ") " << x
+                         << ' ' << y
+                         << ' ' << vel_x
+                         << ' ' << vel_y
+                         << ' ' << body_dir
+                         << ' ' << neck_dir;
 }
 
 void
@@ -101,24 +102,24 @@ SerializerPlayerStdv14::serializeFSPlayerState( std::ostream & strm,
 {
     if ( player.isTackling() )
     {
-        strm << " t";
+        BufferWriter( strm ) << " t";
     }
     else if ( player.kicked() )
     {
-        strm << " k";
+        BufferWriter( strm ) << " k";
     }
     else if ( player.foulCycles() > 0 )
     {
-        strm << " f";
+        BufferWriter( strm ) << " f";
     }
 
     if ( player.hasRedCard() )
     {
-        strm << " r";
+        BufferWriter( strm ) << " r";
     }
     else if ( player.hasYellowCard() )
     {
-        strm << " y";
+        BufferWriter( strm ) << " y";
     }
 }
 
@@ -25,6 +25,8 @@
 
 #include "serializerplayerstdv7.h"
 
+#include "bufferwriter.h"
+
 #include <rcss/clang/clangmsg.h>
 
 namespace rcss {
@@ -46,8 +48,8 @@ SerializerPlayerStdv7::serializeCoachAudio( std::ostream & strm,
                                             const std::string & name,
                                             const char * msg ) const
 {
-    strm << "(hear " << time << ' '
-         << name << " \"" << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << ' '
+                         << name << " \"" << msg << "\")";
 }
 
 void
@@ -65,8 +67,8 @@ SerializerPlayerStdv7::serializeSelfAudio( std::ostream & strm,
                                            const int time,
                                            const char * msg ) const
 {
-    strm << "(hear " << time << " self \""
-         << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << " self \""
+                         << msg << "\")";
 }
 
 void
@@ -75,88 +77,88 @@ SerializerPlayerStdv7::serializePlayerAudio( std::ostream & strm,
                                              const double & dir,
                                              const char * msg ) const
 {
-    strm << "(hear " << time << ' '
-         << dir << " \"" << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << ' '
+                         << dir << " \"" << msg << "\")";
 }
 
 void
 SerializerPlayerStdv7::serializeServerParamBegin( std::ostream & strm ) const
 {
-    strm << "(server_param";
+    BufferWriter( strm ) << "(server_param";
 }
 
 void
 SerializerPlayerStdv7::serializeServerParamEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
 SerializerPlayerStdv7::serializePlayerParamBegin( std::ostream& strm ) const
 {
-    strm << "(player_param";
+    BufferWriter( strm ) << "(player_param";
 }
 
 void
 SerializerPlayerStdv7::serializePlayerParamEnd( std::ostream & strm ) const
 {
-    strm << ")";
+    BufferWriter( strm ) << ")";
 }
 
 void
 SerializerPlayerStdv7::serializePlayerTypeBegin( std::ostream & strm,
                                                  const int ) const
 {
-    strm << "(player_type";
+    BufferWriter( strm ) << "(player_type";
 }
 
 void
 SerializerPlayerStdv7::serializePlayerTypeEnd( std::ostream & strm ) const
 {
-    strm << ')';
+    BufferWriter( strm ) << ')';
 }
 
 void
 SerializerPlayerStdv7::serializeParam( std::ostream & strm,
                                        const int param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerPlayerStdv7::serializeParam( std::ostream & strm,
                                        const unsigned int param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerPlayerStdv7::serializeParam( std::ostream & strm,
                                        const bool param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerPlayerStdv7::serializeParam( std::ostream & strm,
                                        const double & param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerPlayerStdv7::serializeParam( std::ostream & strm,
                                        const std::string & param ) const
 {
-    strm << ' ' << param;
+    BufferWriter( strm ) << ' ' << param;
 }
 
 void
 SerializerPlayerStdv7::serializeChangePlayer( std::ostream & strm,
                                               const int unum ) const
 {
-    strm << "(change_player_type "
-         << unum << ')';
+    BufferWriter( strm ) << "(change_player_type "
+                         << unum << ')';
 }
 
 void
@@ -164,8 +166,8 @@ SerializerPlayerStdv7::serializeChangePlayer( std::ostream & strm,
                                               const int unum,
                                               const int type ) const
 {
-    strm << "(change_player_type "
-         << unum << ' ' << type << ')';
+    BufferWriter( strm ) << "(change_player_type "
+                         << unum << ' ' << type << ')';
 }
 
 const
@@ -25,6 +25,7 @@
 
 #include "serializerplayerstdv8.h"
 
+#include "bufferwriter.h"
 #include "player.h"
 
 namespace rcss {
@@ -47,9 +48,10 @@ SerializerPlayerStdv8::serializeVisualPlayer( std::ostream & strm,
                                               const double & dist,
                                               const int dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir;
-    if ( player.isTackling() ) strm << " t";
-    strm << ')';
+    BufferWriter out( strm );
+    out << " (" << name << ' ' << dist << ' ' << dir;
+    if ( player.isTackling() ) out << " t";
+    out << ')';
 }
 
 
@@ -61,10 +63,11 @@ SerializerPlayerStdv8::serializeVisualPlayer( std::ostream & strm,
                                               const int dir,
                                               const int point_dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir
-         << ' ' << point_dir;
-    if ( player.isTackling() ) strm << " t";
-    strm << ')';
+    BufferWriter out( strm );
+    out << " (" << name << ' ' << dist << ' ' << dir
+        << ' ' << point_dir;
+    if ( player.isTackling() ) out << " t";
+    out << ')';
 }
 
 
@@ -79,11 +82,12 @@ SerializerPlayerStdv8::serializeVisualPlayer( std::ostream & strm,
                                               const int body_dir,
                                               const int head_dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir
-         << ' ' << dist_chg << ' ' << dir_chg
-         << ' ' << body_dir << ' ' << head_dir;
-    if ( player.isTackling() ) strm << " t";
-    strm << ')';
+    BufferWriter out( strm );
+    out << " (" << name << ' ' << dist << ' ' << dir
+        << ' ' << dist_chg << ' ' << dir_chg
+        << ' ' << body_dir << ' ' << head_dir;
+    if ( player.isTackling() ) out << " t";
+    out << ')';
 }
 
 
@@ -99,12 +103,13 @@ SerializerPlayerStdv8::serializeVisualPlayer( std::ostream & strm,
                                               const int head_dir,
                                               const int point_dir ) const
 {
-    strm << " (" << name << ' ' << dist << ' ' << dir
-         << ' ' << dist_chg << ' ' << dir_chg
-         << ' ' << body_dir << ' ' << head_dir
-         << ' ' << point_dir;
-    if ( player.isTackling() ) strm << " t";
-    strm << ')';
+    BufferWriter out( strm );
+    out << " (" << name << ' ' << dist << ' ' << dir
+        << ' ' << dist_chg << ' ' << dir_chg
+        << ' ' << body_dir << ' ' << head_dir
+        << ' ' << point_dir;
+    if ( player.isTackling() ) out << " t";
+    out << ')';
 }
 
 
@@ -115,9 +120,9 @@ SerializerPlayerStdv8::serializeAllyAudioFull( std::ostream & strm,
                                                const int unum,
                                                const char* msg ) const
 {
-    strm << "(hear " << time << ' '
-         << dir << " our " << unum
-         << " \"" << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << ' '
+                         << dir << " our " << unum
+                         << " \"" << msg << "\")";
 }
 
 void
@@ -126,8 +131,8 @@ SerializerPlayerStdv8::serializeOppAudioFull( std::ostream & strm,
                                               const double & dir,
                                               const char* msg ) const
 {
-    strm << "(hear " << time << ' '
-         << dir << " opp \"" << msg << "\")";
+    BufferWriter( strm ) << "(hear " << time << ' '
+                         << dir << " opp \"" << msg << "\")";
 }
 
 void
@@ -135,14 +140,14 @@ SerializerPlayerStdv8::serializeAllyAudioShort( std::ostream & strm,
                                                 const int time,
                                                 const int unum ) const
 {
-    strm << "(hear " << time << " our " << unum << ')';
+    BufferWriter( strm ) << "(hear " << time << " our " << unum << ')';
 }
 
 void
 SerializerPlayerStdv8::serializeOppAudioShort( std::ostream & strm,
                                                const int time ) const
 {
-    strm << "(hear " << time << " opp)";
+    BufferWriter( strm ) << "(hear " << time << " opp)";
 }
 
 
@@ -153,12 +158,12 @@ SerializerPlayerStdv8::serializeFSBall( std::ostream & strm,
                                         const double & vel_x,
                                         const double & vel_y ) const
 {
-    strm << " ((b)"
-         << ' ' << x
-         << ' ' << y
-         << ' ' << vel_x
-         << ' ' << vel_y
-         << ')';
+    BufferWriter( strm ) << " ((b)"
+                         << ' ' << x
+                         << ' ' << y
+                         << ' ' << vel_x
+                         << ' ' << vel_y
+                         << ')';
 }
 
 void
@@ -175,24 +180,24 @@ SerializerPlayerStdv8::serializeFSPlayerBegin( std::ostream & strm,
                                                const double & neck_dir ) const
 
 {
-    strm << " ((p " << side
-         << ' ' << unum;
+    BufferWriter( strm ) << " ((p " << side
+                         << ' ' << unum;
 
     if ( goalie )
     {
-        strm << " g";
+        BufferWriter( strm ) << " g";
     }
     else
     {
-        strm << ' ' << type; // hetro player type
+        BufferWriter( strm ) << ' ' << type; // hetro player type
     }
 
-    strm << ") " << x
-         << ' ' << y
-         << ' ' << vel_x
-         << ' ' << vel_y
-         << ' ' << body_dir
-         << ' ' << neck_dir;
+    BufferWriter( strm ) << ") " << x
+                         << ' ' << y
+                         << ' ' << vel_x
+                         << ' ' << vel_y
+                         << ' ' << body_dir
+                         << ' ' << neck_dir;
 }
 
 void
@@ -200,8 +205,8 @@ SerializerPlayerStdv8::serializeFSPlayerArm( std::ostream & strm,
                                              const double & mag,
                                              const double & head ) const
 {
-    strm << ' ' << mag
-         << ' ' << head;
+    BufferWriter( strm ) << ' ' << mag
+                         << ' ' << head;
 }
 
 void
@@ -211,10 +216,10 @@ SerializerPlayerStdv8::serializeFSPlayerStamina( std::ostream & strm,
                                                  const double & recovery,
                                                  const double & /*stamina_capacity*/ ) const
 {
-    strm << " (stamina " << stamina
-         << ' ' << effort
-         << ' ' << recovery
-         << ')';
+    BufferWriter( strm ) << " (stamina " << stamina
+                         << ' ' << effort
+                         << ' ' << recovery
+                         << ')';
 }
 
 void
@@ -228,34 +233,34 @@ SerializerPlayerStdv8::serializeFSCounts( std::ostream & strm,
                                           const int count_change_view,
                                           const int count_say ) const
 {
-    strm << " (count "
-         << count_kick << ' '
-         << count_dash << ' '
-         << count_turn << ' '
-         << count_catch << ' '
-         << count_move << ' '
-         << count_turn_neck << ' '
-         << count_change_view << ' '
-         << count_say << ')';
+    BufferWriter( strm ) << " (count "
+                         << count_kick << ' '
+                         << count_dash << ' '
+                         << count_turn << ' '
+                         << count_catch << ' '
+                         << count_move << ' '
+                         << count_turn_neck << ' '
+                         << count_change_view << ' '
+                         << count_say << ')';
 }
 
 void
 SerializerPlayerStdv8::serializeServerParamBegin( std::ostream & strm ) const
 {
-    strm << "(server_param ";
+    BufferWriter( strm ) << "(server_param ";
 }
 
 void
 SerializerPlayerStdv8::serializePlayerParamBegin( std::ostream & strm ) const
 {
-    strm << "(player_param ";
+    BufferWriter( strm ) << "(player_param ";
 }
 
 void
 SerializerPlayerStdv8::serializePlayerTypeBegin( std::ostream & strm,
                                                  const int ) const
 {
-    strm << "(player_type ";
+    BufferWriter( strm ) << "(player_type ";
 }
 
 void
@@ -263,7 +268,7 @@ SerializerPlayerStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const int param ) const
 {
-    strm << "(" << name << ' ' << param << ')';
+    BufferWriter( strm ) << "(" << name << ' ' << param << ')';
 }
 
 void
@@ -271,7 +276,7 @@ SerializerPlayerStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const bool param ) const
 {
-    strm << "(" << name << ' ' << param << ')';
+    BufferWriter( strm ) << "(" << name << ' ' << param << ')';
 }
 
 void
@@ -279,7 +284,7 @@ SerializerPlayerStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const double & param ) const
 {
-    strm << "(" << name << ' ' << param << ')';
+    BufferWriter( strm ) << "(" << name << ' ' << param << ')';
 }
 
 void
@@ -287,7 +292,7 @@ SerializerPlayerStdv8::serializeParam( std::ostream & strm,
                                        const std::string & name,
                                        const std::string & param ) const
 {
-    strm << "(" << name << " \"" << param << "\")";
+    BufferWriter( strm ) << "(" << name << " \"" << param << "\")";
 }
 
 const
@@ -0,0 +1,723 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              serializertest.cpp
+                  Golden output test of the std serializers
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+/*
+ * Writes the same messages through the player, coach and online coach
+ * serializers of every protocol version and compares the result with
+ * the output the serializers produced when they still wrote every
+ * value with std::ostream's operator<<.  The values are chosen to
+ * cover the corner cases of "%g": rounding up to the next power of
+ * ten, the switch to the exponent notation, signed zero and long
+ * fractions.  The messages that need a Player or a clang::Msg are not
+ * covered.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "serializer.h"
+#include "object.h"
+#include "types.h"
+
+#include <iostream>
+#include <locale>
+#include <sstream>
+#include <string>
+
+namespace {
+
+const int MIN_VERSION = 1;
+const int MAX_VERSION = 17;
+
+const int TIME = 2345;
+
+/*!
+  \struct Golden
+  \brief the expected output of the versions sharing one serializer.
+ */
+struct Golden {
+    int first_version_;
+    int last_version_;
+    const char * output_;
+};
+
+const Golden PLAYER_GOLDEN[] = {
+    { 1, 6,
+      "(init l 7 before_kick_off)\n"
+      "(reconnect r play_on)\n"
+      "\n"
+      "\n"
+      "(hear 2345 referee kick_off_l)\n"
+      "(hear 2345 online_coach_left (info (true) \"x\"))\n"
+      "(hear 2345 self pass)\n"
+      "(hear 2345 -12.75 go)\n"
+      "\n"
+      "\n"
+      "\n"
+      "\n"
+      "(see 2345 (F -38) (f c 12.2 0) (f l t 63.4 -27 0 -0) "
+      "(b 0.333333 5 -0.00012 2.5e-07) "
+      "(p \"Team\" 3 9.97 45 1e+06 1.23457e+06 90) "
+      "(p \"Team\" 4 20.1 -1 0.054 -0.6 180 -90) (p \"Opp\" 49.4 12 t) "
+      "(p 66.7 -44 30) (p \"Opp\" 11 4.5 3 0.09 1.8 -170 60 t) "
+      "(p \"Opp\" 10 5.5 4 -0.09 -1.8 170 -60 15 t))\n"
+      "(sense_body 2345 (view_mode high normal) "
+      "(stamina 7891.25 0.987654) (speed 0.999995) (speed 0.456 -32) "
+      "(kick 1) (dash 22) (turn 333) (say 4444) (catch 5) (move 66) "
+      "(change_view 777) (head_angle -90) (turn_neck 88) "
+      "(arm (movable 1) (expires 2) (target 12.345 -30) (count 3)) "
+      "(focus (target none) (count 4)) (focus (target l 7) (count 5)) "
+      "(tackle (expires 6) (count 7)) (collision (ball) (post)) "
+      "(collision none))\n"
+      "(fullstate 2345 (pmode play_on) (vmode low wide) (score 2 1) "
+      "(ball -52.5 34 2.7 -0.00049) "
+      "(l_1 -49.75 0.125 0 -0 180 -45.5 8000 1 0.505))\n"
+      "\n"
+      "\n"
+      "(ok clang (ver 7 8))\n"
+      "(error no team with name NoSuchTeam)\n"
+      "(score 2345 3 0)\n" },
+    { 7, 7,
+      "(init l 7 before_kick_off)\n"
+      "(reconnect r play_on)\n"
+      "(server_param)\n"
+      "(player_type 3)\n"
+      "(hear 2345 referee kick_off_l)\n"
+      "(hear 2345 online_coach_left \"(info (true) \"x\")\")\n"
+      "(hear 2345 self \"pass\")\n"
+      "(hear 2345 -12.75 \"go\")\n"
+      "\n"
+      "\n"
+      "\n"
+      "\n"
+      "(see 2345 (F -38) (f c 12.2 0) (f l t 63.4 -27 0 -0) "
+      "(b 0.333333 5 -0.00012 2.5e-07) "
+      "(p \"Team\" 3 9.97 45 1e+06 1.23457e+06 90) "
+      "(p \"Team\" 4 20.1 -1 0.054 -0.6 180 -90) (p \"Opp\" 49.4 12 t) "
+      "(p 66.7 -44 30) (p \"Opp\" 11 4.5 3 0.09 1.8 -170 60 t) "
+      "(p \"Opp\" 10 5.5 4 -0.09 -1.8 170 -60 15 t))\n"
+      "(sense_body 2345 (view_mode high normal) "
+      "(stamina 7891.25 0.987654) (speed 0.999995) (speed 0.456 -32) "
+      "(kick 1) (dash 22) (turn 333) (say 4444) (catch 5) (move 66) "
+      "(change_view 777) (head_angle -90) (turn_neck 88) "
+      "(arm (movable 1) (expires 2) (target 12.345 -30) (count 3)) "
+      "(focus (target none) (count 4)) (focus (target l 7) (count 5)) "
+      "(tackle (expires 6) (count 7)) (collision (ball) (post)) "
+      "(collision none))\n"
+      "(fullstate 2345 (pmode play_on) (vmode low wide) (score 2 1) "
+      "(ball -52.5 34 2.7 -0.00049) "
+      "(l_1 -49.75 0.125 0 -0 180 -45.5 8000 1 0.505))\n"
+      "(change_player_type 9)\n"
+      "(change_player_type 10 17)\n"
+      "(ok clang (ver 7 8))\n"
+      "(error no team with name NoSuchTeam)\n"
+      "(score 2345 3 0)\n" },
+    { 8, 12,
+      "(init l 7 before_kick_off)\n"
+      "(reconnect r play_on)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear 2345 referee kick_off_l)\n"
+      "(hear 2345 online_coach_left \"(info (true) \"x\")\")\n"
+      "(hear 2345 self \"pass\")\n"
+      "(hear 2345 -12.75 \"go\")\n"
+      "(hear 2345 33 our 9 \"ok\")\n"
+      "(hear 2345 -0 opp \"no\")\n"
+      "(hear 2345 our 9)\n"
+      "(hear 2345 opp)\n"
+      "(see 2345 (F -38) (f c 12.2 0) (f l t 63.4 -27 0 -0) "
+      "(b 0.333333 5 -0.00012 2.5e-07) "
+      "(p \"Team\" 3 9.97 45 1e+06 1.23457e+06 90) "
+      "(p \"Team\" 4 20.1 -1 0.054 -0.6 180 -90) (p \"Opp\" 49.4 12 t) "
+      "(p 66.7 -44 30) (p \"Opp\" 11 4.5 3 0.09 1.8 -170 60 t) "
+      "(p \"Opp\" 10 5.5 4 -0.09 -1.8 170 -60 15 t))\n"
+      "(sense_body 2345 (view_mode high normal) "
+      "(stamina 7891.25 0.987654) (speed 0.999995) (speed 0.456 -32) "
+      "(kick 1) (dash 22) (turn 333) (say 4444) (catch 5) (move 66) "
+      "(change_view 777) (head_angle -90) (turn_neck 88) "
+      "(arm (movable 1) (expires 2) (target 12.345 -30) (count 3)) "
+      "(focus (target none) (count 4)) (focus (target l 7) (count 5)) "
+      "(tackle (expires 6) (count 7)) (collision (ball) (post)) "
+      "(collision none))\n"
+      "(fullstate 2345 (pmode play_on) (vmode low wide) "
+      "(count 1 2 3 4 5 6 7 8) (score 2 1) ((b) -52.5 34 2.7 -0.00049) "
+      "((p l 1 g) -49.75 0.125 0 -0 180 -45.5 1.23457 100000 (stamina 8000 1 0.505)))\n"
+      "(change_player_type 9)\n"
+      "(change_player_type 10 17)\n"
+      "(ok clang (ver 7 8))\n"
+      "(error no team with name NoSuchTeam)\n"
+      "(score 2345 3 0)\n" },
+    { 13, 13,
+      "(init l 7 before_kick_off)\n"
+      "(reconnect r play_on)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear 2345 referee kick_off_l)\n"
+      "(hear 2345 online_coach_left \"(info (true) \"x\")\")\n"
+      "(hear 2345 self \"pass\")\n"
+      "(hear 2345 -12.75 \"go\")\n"
+      "(hear 2345 33 our 9 \"ok\")\n"
+      "(hear 2345 -0 opp \"no\")\n"
+      "(hear 2345 our 9)\n"
+      "(hear 2345 opp)\n"
+      "(see 2345 (F -38) (f c 12.2 0) (f l t 63.4 -27 0 -0) "
+      "(b 0.333333 5 -0.00012 2.5e-07) "
+      "(p \"Team\" 3 9.97 45 1e+06 1.23457e+06 90) "
+      "(p \"Team\" 4 20.1 -1 0.054 -0.6 180 -90) (p \"Opp\" 49.4 12 t) "
+      "(p 66.7 -44 30) (p \"Opp\" 11 4.5 3 0.09 1.8 -170 60 t) "
+      "(p \"Opp\" 10 5.5 4 -0.09 -1.8 170 -60 15 t))\n"
+      "(sense_body 2345 (view_mode high normal) "
+      "(stamina 7891.25 0.987654 125000) (speed 0.999995) "
+      "(speed 0.456 -32) (kick 1) (dash 22) (turn 333) (say 4444) "
+      "(catch 5) (move 66) (change_view 777) (head_angle -90) "
+      "(turn_neck 88) "
+      "(arm (movable 1) (expires 2) (target 12.345 -30) (count 3)) "
+      "(focus (target none) (count 4)) (focus (target l 7) (count 5)) "
+      "(tackle (expires 6) (count 7)) (collision (ball) (post)) "
+      "(collision none))\n"
+      "(fullstate 2345 (pmode play_on) (vmode low wide) "
+      "(count 1 2 3 4 5 6 7 8) (score 2 1) ((b) -52.5 34 2.7 -0.00049) "
+      "((p l 1 g) -49.75 0.125 0 -0 180 -45.5 1.23457 100000 (stamina 8000 1 0.505 130600)))\n"
+      "(change_player_type 9)\n"
+      "(change_player_type 10 17)\n"
+      "(ok clang (ver 7 8))\n"
+      "(error no team with name NoSuchTeam)\n"
+      "(score 2345 3 0)\n" },
+    { 14, 17,
+      "(init l 7 before_kick_off)\n"
+      "(reconnect r play_on)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear 2345 referee kick_off_l)\n"
+      "(hear 2345 online_coach_left \"(info (true) \"x\")\")\n"
+      "(hear 2345 self \"pass\")\n"
+      "(hear 2345 -12.75 \"go\")\n"
+      "(hear 2345 33 our 9 \"ok\")\n"
+      "(hear 2345 -0 opp \"no\")\n"
+      "(hear 2345 our 9)\n"
+      "(hear 2345 opp)\n"
+      "(see 2345 (F -38) (f c 12.2 0) (f l t 63.4 -27 0 -0) "
+      "(b 0.333333 5 -0.00012 2.5e-07) "
+      "(p \"Team\" 3 9.97 45 1e+06 1.23457e+06 90) "
+      "(p \"Team\" 4 20.1 -1 0.054 -0.6 180 -90) (p \"Opp\" 49.4 12 t) "
+      "(p 66.7 -44 30) (p \"Opp\" 11 4.5 3 0.09 1.8 -170 60 t) "
+      "(p \"Opp\" 10 5.5 4 -0.09 -1.8 170 -60 15 t))\n"
+      "(sense_body 2345 (view_mode high normal) "
+      "(stamina 7891.25 0.987654 125000) (speed 0.999995) "
+      "(speed 0.456 -32) (kick 1) (dash 22) (turn 333) (say 4444) "
+      "(catch 5) (move 66) (change_view 777) (head_angle -90) "
+      "(turn_neck 88) "
+      "(arm (movable 1) (expires 2) (target 12.345 -30) (count 3)) "
+      "(focus (target none) (count 4)) (focus (target l 7) (count 5)) "
+      "(tackle (expires 6) (count 7)) (collision (ball) (post)) "
+      "(collision none))\n"
+      "(fullstate 2345 (pmode play_on) (vmode low wide) "
+      "(count 1 2 3 4 5 6 7 8) (score 2 1) ((b) -52.5 34 2.7 -0.00049) "
+      "((p l 1 g 0) -49.75 0.125 0 -0 180 -45.5 1.23457 100000 (stamina 8000 1 0.505 130600)))\n"
+      "(change_player_type 9)\n"
+      "(change_player_type 10 17)\n"
+      "(ok clang (ver 7 8))\n"
+      "(error no team with name NoSuchTeam)\n"
+      "(score 2345 3 0)\n" },
+};
+
+const Golden COACH_GOLDEN[] = {
+    { 1, 6,
+      "(init ok)\n"
+      "\n"
+      "\n"
+      "(hear referee 2345 goal_l_1)\n"
+      "(hear online_coach_right 2345 (freeform \"hi\"))\n"
+      "(hear Team 7 2345 pass)\n"
+      "(see 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 -180 90 0 0.3))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n"
+      "(ok eye on)\n"
+      "(ok eye off)\n" },
+    { 7, 7,
+      "(init ok)\n"
+      "(server_param)\n"
+      "(player_type 3)\n"
+      "(hear referee 2345 goal_l_1)\n"
+      "(hear 2345 online_coach_right \"(freeform \"hi\")\")\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n"
+      "(ok eye on)\n"
+      "(ok eye off)\n" },
+    { 8, 12,
+      "(init ok)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear referee 2345 goal_l_1)\n"
+      "(hear 2345 online_coach_right \"(freeform \"hi\")\")\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90) "
+      "(p \"Team\" 2 123457 -0.5 0.01 0 0 -15 t) "
+      "(p \"Opp\" 3 10 20 -0.25 0.75 45 0 30))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n"
+      "(ok eye on)\n"
+      "(ok eye off)\n" },
+    { 13, 13,
+      "(init ok)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear referee 2345 goal_l_1)\n"
+      "(hear 2345 online_coach_right \"(freeform \"hi\")\")\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90) "
+      "(p \"Team\" 2 123457 -0.5 0.01 0 0 -15 t) "
+      "(p \"Opp\" 3 10 20 -0.25 0.75 45 0 30))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n"
+      "(ok eye on)\n"
+      "(ok eye off)\n" },
+    { 14, 17,
+      "(init ok)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear referee 2345 goal_l_1)\n"
+      "(hear 2345 online_coach_right \"(freeform \"hi\")\")\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90) "
+      "(p \"Team\" 2 123457 -0.5 0.01 0 0 -15 t) "
+      "(p \"Opp\" 3 10 20 -0.25 0.75 45 0 30))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n"
+      "(ok eye on)\n"
+      "(ok eye off)\n" },
+};
+
+const Golden ONLINE_COACH_GOLDEN[] = {
+    { 1, 5,
+      "(init ok)\n"
+      "(init ok)\n"
+      "\n"
+      "\n"
+      "(hear 2345 referee drop_ball)\n"
+      "(hear 2345 Team 7 pass)\n"
+      "\n"
+      "\n"
+      "\n"
+      "(see 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 -180 90 0 0.3))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n" },
+    { 6, 6,
+      "(init r ok)\n"
+      "(init r ok)\n"
+      "\n"
+      "\n"
+      "(hear 2345 referee drop_ball)\n"
+      "(hear 2345 Team 7 pass)\n"
+      "\n"
+      "\n"
+      "\n"
+      "(see 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 -180 90 0 0.3))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n" },
+    { 7, 7,
+      "(init r ok)\n"
+      "(init r ok)\n"
+      "(server_param)\n"
+      "(player_type 3)\n"
+      "(hear 2345 referee drop_ball)\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "\n"
+      "(change_player_type 4)\n"
+      "(change_player_type 5 12)\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n" },
+    { 8, 12,
+      "(init r ok)\n"
+      "(init r ok)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear 2345 referee drop_ball)\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "(clang (ver Team 7 7 8))\n"
+      "(change_player_type 4)\n"
+      "(change_player_type 5 12)\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90) "
+      "(p \"Team\" 2 123457 -0.5 0.01 0 0 -15 t) "
+      "(p \"Opp\" 3 10 20 -0.25 0.75 45 0 30))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n" },
+    { 13, 13,
+      "(init r ok)\n"
+      "(init r ok)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear 2345 referee drop_ball)\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "(clang (ver Team 7 7 8))\n"
+      "(change_player_type 4)\n"
+      "(change_player_type 5 12)\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90) "
+      "(p \"Team\" 2 123457 -0.5 0.01 0 0 -15 t) "
+      "(p \"Opp\" 3 10 20 -0.25 0.75 45 0 30))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n" },
+    { 14, 17,
+      "(init r ok)\n"
+      "(init r ok)\n"
+      "(server_param (goal_width 14.02)(stamina_max 8000)"
+      "(stamina_capacity 130600)(wind_rand 0)(ball_decay 0.94)"
+      "(inertia_moment 5)(min_dash_power -100)(effort_dec_thr 0.3)"
+      "(tackle_rand_factor 0.333333)(max_tackle_power 100)"
+      "(quantize_step 1e-05)(half_time 300)(drop_ball_time -1)"
+      "(auto_mode 1)(landmark_file \"~/.rcssserver-landmark.xml\"))\n"
+      "(player_type (id 3)(player_speed_max 1.05)(kick_rand 0.123457)"
+      "(kickable_margin 0.7))\n"
+      "(hear 2345 referee drop_ball)\n"
+      "(hear 2345 Team 7 \"pass\")\n"
+      "(clang (ver Team 7 7 8))\n"
+      "(change_player_type 4)\n"
+      "(change_player_type 5 12)\n"
+      "(see_global 2345 (g l -52.5 0) (b 0.333333 -0 3 -1e-05) "
+      "(p \"Team\" 1 goalie -50.1235 7.5 0 0.3 -180 90) "
+      "(p \"Team\" 2 123457 -0.5 0.01 0 0 -15 t) "
+      "(p \"Opp\" 3 10 20 -0.25 0.75 45 0 30))\n"
+      "(ok look 2345 (b 0.5 0.25 0 0))\n" },
+};
+
+
+void
+writeParams( std::ostream & o,
+             const rcss::Serializer & ser )
+{
+    ser.serializeServerParamBegin( o );
+    ser.serializeParam( o, "goal_width", 14.02 );
+    ser.serializeParam( o, "stamina_max", 8000.0 );
+    ser.serializeParam( o, "stamina_capacity", 130600.0 );
+    ser.serializeParam( o, "wind_rand", 0.0 );
+    ser.serializeParam( o, "ball_decay", 0.94 );
+    ser.serializeParam( o, "inertia_moment", 5.0 );
+    ser.serializeParam( o, "min_dash_power", -100.0 );
+    ser.serializeParam( o, "effort_dec_thr", 0.3 );
+    ser.serializeParam( o, "tackle_rand_factor", 1.0 / 3.0 );
+    ser.serializeParam( o, "max_tackle_power", 99.999999 );
+    ser.serializeParam( o, "quantize_step", 0.00001 );
+    ser.serializeParam( o, "half_time", 300 );
+    ser.serializeParam( o, "drop_ball_time", -1 );
+    ser.serializeParam( o, "auto_mode", true );
+    ser.serializeParam( o, "landmark_file", std::string( "~/.rcssserver-landmark.xml" ) );
+    ser.serializeServerParamEnd( o );
+    o << '\n';
+
+    ser.serializePlayerTypeBegin( o, 3 );
+    ser.serializeParam( o, "player_speed_max", 1.05 );
+    ser.serializeParam( o, "kick_rand", 0.1234567 );
+    ser.serializeParam( o, "kickable_margin", 0.7 );
+    ser.serializePlayerTypeEnd( o );
+    o << '\n';
+}
+
+
+void
+writePlayer( std::ostream & o,
+             const rcss::SerializerPlayer & ser )
+{
+    ser.serializeInit( o, "l", 7, PM_BeforeKickOff );
+    o << '\n';
+    ser.serializeReconnect( o, "r", PM_PlayOn );
+    o << '\n';
+
+    writeParams( o, ser );
+
+    ser.serializeRefereeAudio( o, TIME, "kick_off_l" );
+    o << '\n';
+    ser.serializeCoachAudio( o, TIME, "online_coach_left", "(info (true) \"x\")" );
+    o << '\n';
+    ser.serializeSelfAudio( o, TIME, "pass" );
+    o << '\n';
+    ser.serializePlayerAudio( o, TIME, -12.75, "go" );
+    o << '\n';
+    ser.serializeAllyAudioFull( o, TIME, 33.0, 9, "ok" );
+    o << '\n';
+    ser.serializeOppAudioFull( o, TIME, -0.0, "no" );
+    o << '\n';
+    ser.serializeAllyAudioShort( o, TIME, 9 );
+    o << '\n';
+    ser.serializeOppAudioShort( o, TIME );
+    o << '\n';
+
+    ser.serializeVisualBegin( o, TIME );
+    ser.serializeVisualObject( o, "F", -38 );
+    ser.serializeVisualObject( o, "f c", 12.2, 0 );
+    ser.serializeVisualObject( o, "f l t", 63.4, -27, 0.0, -0.0 );
+    ser.serializeVisualObject( o, "b", 1.0 / 3.0, 5, -0.00012, 2.5e-7 );
+    ser.serializeVisualObject( o, "p \"Team\" 3", 9.97, 45, 999999.5, 1234567.0, 90 );
+    ser.serializeVisualObject( o, "p \"Team\" 4", 20.1, -1, 0.054, -0.6, 180, -90 );
+    ser.serializeVisualObject( o, "p \"Opp\"", 49.4, 12, true );
+    ser.serializeVisualObject( o, "p", 66.7, -44, 30, false );
+    ser.serializeVisualObject( o, "p \"Opp\" 11", 4.5, 3, 0.09, 1.8, -170, 60, true );
+    ser.serializeVisualObject( o, "p \"Opp\" 10", 5.5, 4, -0.09, -1.8, 170, -60, 15, true );
+    ser.serializeVisualEnd( o );
+    o << '\n';
+
+    ser.serializeBodyBegin( o, TIME );
+    ser.serializeBodyViewMode( o, "high", "normal" );
+    ser.serializeBodyStamina( o, 7891.25, 0.987654321, 125000.0 );
+    ser.serializeBodyVelocity( o, 0.999995 );
+    ser.serializeBodyVelocity( o, 0.456, -32 );
+    ser.serializeBodyCounts( o, 1, 22, 333, 4444 );
+    ser.serializeBodyCounts( o, 5, 66, 777 );
+    ser.serializeNeckAngle( o, -90 );
+    ser.serializeNeckCount( o, 88 );
+    ser.serializeArm( o, 1, 2, 12.345, -30, 3 );
+    ser.serializeFocus( o, "none", 4 );
+    ser.serializeFocus( o, "l", 7, 5 );
+    ser.serializeTackle( o, 6, 7 );
+    ser.serializeCollision( o, true, false, true );
+    ser.serializeCollision( o, false, false, false );
+    ser.serializeBodyEnd( o );
+    o << '\n';
+
+    ser.serializeFSBegin( o, TIME );
+    ser.serializeFSPlayMode( o, "play_on" );
+    ser.serializeFSViewMode( o, "low", "wide" );
+    ser.serializeFSCounts( o, 1, 2, 3, 4, 5, 6, 7, 8 );
+    ser.serializeFSScore( o, 2, 1 );
+    ser.serializeFSBall( o, -52.5, 34.0, 2.7, -0.00049 );
+    ser.serializeFSPlayerBegin( o, 'l', 1, true, 0,
+                                -49.75, 0.125, 0.0, -0.0,
+                                179.99999, -45.5 );
+    ser.serializeFSPlayerArm( o, 1.23456789, 100000.0 );
+    ser.serializeFSPlayerStamina( o, 8000.0, 1.0, 0.505, 130600.0 );
+    ser.serializeFSPlayerEnd( o );
+    ser.serializeFSEnd( o );
+    o << '\n';
+
+    ser.serializeChangePlayer( o, 9 );
+    o << '\n';
+    ser.serializeChangePlayer( o, 10, 17 );
+    o << '\n';
+    ser.serializeOKClang( o, 7, 8 );
+    o << '\n';
+    ser.serializeErrorNoTeamName( o, "NoSuchTeam" );
+    o << '\n';
+    ser.serializeScore( o, TIME, 3, 0 );
+    o << '\n';
+}
+
+
+void
+writeCoachVisual( std::ostream & o,
+                  const rcss::SerializerCoach & c )
+{
+    c.serializeVisualBegin( o, TIME );
+    c.serializeVisualObject( o, "g l", PVector( -52.5, 0.0 ) );
+    c.serializeVisualObject( o, "b", PVector( 1.0 / 3.0, -0.0 ), PVector( 2.999999, -1e-5 ) );
+    c.serializeVisualObject( o, "p \"Team\" 1 goalie",
+                             PVector( -50.123456, 7.5 ), PVector( 0.0, 0.3 ),
+                             -180, 90 );
+    c.serializeVisualObject( o, "p \"Team\" 2",
+                             PVector( 123456.7, -0.5 ), PVector( 0.01, 0.0 ),
+                             0, -15, true );
+    c.serializeVisualObject( o, "p \"Opp\" 3",
+                             PVector( 10.0, 20.0 ), PVector( -0.25, 0.75 ),
+                             45, 0, 30, false );
+    c.serializeVisualEnd( o );
+    o << '\n';
+
+    c.serializeLookBegin( o, TIME );
+    c.serializeVisualObject( o, "b", PVector( 0.5, 0.25 ), PVector( 0.0, 0.0 ) );
+    c.serializeLookEnd( o );
+    o << '\n';
+}
+
+
+void
+writeCoach( std::ostream & o,
+            const rcss::SerializerCoach & ser )
+{
+    ser.serializeInit( o );
+    o << '\n';
+
+    writeParams( o, ser );
+
+    ser.serializeRefereeAudio( o, TIME, "goal_l_1" );
+    o << '\n';
+    ser.serializeCoachAudio( o, TIME, "online_coach_right", "(freeform \"hi\")" );
+    o << '\n';
+    ser.serializePlayerAudio( o, TIME, "Team 7", "pass" );
+    o << '\n';
+
+    writeCoachVisual( o, ser );
+
+    ser.serializeOKEye( o, true );
+    o << '\n';
+    ser.serializeOKEye( o, false );
+    o << '\n';
+}
+
+
+void
+writeOnlineCoach( std::ostream & o,
+                  const rcss::SerializerOnlineCoach & ser )
+{
+    ser.serializeInit( o );
+    o << '\n';
+    ser.serializeInit( o, RIGHT );
+    o << '\n';
+
+    writeParams( o, ser );
+
+    ser.serializeRefereeAudio( o, TIME, "referee", "drop_ball" );
+    o << '\n';
+    ser.serializePlayerAudio( o, TIME, "Team 7", "pass" );
+    o << '\n';
+    ser.serializePlayerClangVer( o, "Team 7", 7, 8 );
+    o << '\n';
+    ser.serializeChangedPlayer( o, 4 );
+    o << '\n';
+    ser.serializeChangedPlayer( o, 5, 12 );
+    o << '\n';
+
+    writeCoachVisual( o, ser.coachSerializer() );
+}
+
+
+template < typename S, typename W >
+int
+check( const char * name,
+       const Golden * golden,
+       const std::size_t n,
+       W write )
+{
+    int errors = 0;
+
+    for ( int v = MIN_VERSION; v <= MAX_VERSION; ++v )
+    {
+        const Golden * g = golden;
+        while ( g != golden + n
+                && ( v < g->first_version_ || g->last_version_ < v ) )
+        {
+            ++g;
+        }
+
+        typename S::Creator creator;
+        if ( g == golden + n
+             || ! S::factory().getCreator( creator, v ) )
+        {
+            std::cerr << name << " v" << v << ": no serializer or no golden output" << std::endl;
+            ++errors;
+            continue;
+        }
+
+        const typename S::Ptr ser = creator();
+
+        std::ostringstream o;
+        write( o, *ser );
+
+        if ( o.str() != g->output_ )
+        {
+            std::cerr << name << " v" << v << ": output differs\n"
+                      << "expected:\n" << g->output_
+                      << "got:\n" << o.str() << std::endl;
+            ++errors;
+        }
+    }
+
+    return errors;
+}
+
+}
+
+int
+main()
+{
+    std::locale::global( std::locale::classic() );
+
+    int errors = 0;
+    errors += check< rcss::SerializerPlayer >( "player",
+                                               PLAYER_GOLDEN,
+                                               sizeof( PLAYER_GOLDEN ) / sizeof( Golden ),
+                                               &writePlayer );
+    errors += check< rcss::SerializerCoach >( "coach",
+                                              COACH_GOLDEN,
+                                              sizeof( COACH_GOLDEN ) / sizeof( Golden ),
+                                              &writeCoach );
+    errors += check< rcss::SerializerOnlineCoach >( "online coach",
+                                                    ONLINE_COACH_GOLDEN,
+                                                    sizeof( ONLINE_COACH_GOLDEN ) / sizeof( Golden ),
+                                                    &writeOnlineCoach );
+
+    if ( errors > 0 )
+    {
+        return 1;
+    }
+
+    std::cout << "success\n";
+    return 0;
+}
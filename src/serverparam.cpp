@@ -496,6 +496,7 @@ ServerParam::init( const int & argc,
     }
 
     instance().setSlowDownFactor();
+    instance().M_team_size = std::max( 1, std::min( instance().M_team_size, MAX_TEAM_SIZE ) );
 
     return true;
 }
@@ -894,6 +895,22 @@ ServerParam::addParams()
     addParam( "synch_see_offset", M_synch_see_offset, "", 12 );
 
     addParam( "max_monitors", M_max_monitors, "", 999 );
+    addParam( "io_uring", M_io_uring,
+              "If set, client messages are queued on an io_uring and sent in batches", 999 );
+    addParam( "socket_path", M_socket_path,
+              "If not empty, players connect to this Unix domain socket instead of the player port. A leading '@' selects the abstract namespace", 999 );
+    addParam( "coach_socket_path", M_coach_socket_path,
+              "If not empty, the trainer connects to this Unix domain socket instead of the coach port", 999 );
+    addParam( "olcoach_socket_path", M_olcoach_socket_path,
+              "If not empty, coaches connect to this Unix domain socket instead of the online coach port", 999 );
+    addParam( "ingest_thread", M_ingest_thread,
+              "If set, the datagrams of the dedicated client sockets are read and decompressed on a separate thread while the simulation runs. They are still parsed by the simulation", 999 );
+    addParam( "output_thread", M_output_thread,
+              "If set, client messages are sent and the log files are written on separate threads while the simulation runs", 999 );
+    addParam( "worker_threads", M_worker_threads,
+              "The number of extra threads that build the player visual messages. With 0, they are built on the simulation thread", 999 );
+    addParam( "team_size", M_team_size,
+              "The maximum number of players on each team, at most 100. The binary monitor and log formats only show the first 11 of each team", 999 );
     // v12.1.3
     addParam( "extra_half_time",
               rcss::conf::makeSetter( this, &ServerParam::setExtraHalfTime ),
@@ -1417,6 +1434,14 @@ ServerParam::setDefaults()
     M_synch_see_offset = SYNCH_SEE_OFFSET;
 
     M_max_monitors = -1;
+    M_io_uring = false;
+    M_socket_path.clear();
+    M_coach_socket_path.clear();
+    M_olcoach_socket_path.clear();
+    M_ingest_thread = false;
+    M_output_thread = false;
+    M_worker_threads = 0;
+    M_team_size = MAX_PLAYER;
 
     // 13.0.0
     M_stamina_capacity = STAMINA_CAPACITY;
@@ -581,6 +581,14 @@ private:
     double M_player_speed_max_min; // minumum value of player speed max
     double M_extra_stamina;
     int M_max_monitors; //!< The maximum number of monitor client connection.
+    bool M_io_uring; //!< send client messages through an io_uring
+    std::string M_socket_path; //!< Unix socket used instead of the player port, if not empty
+    std::string M_coach_socket_path; //!< Unix socket used instead of the offline coach port, if not empty
+    std::string M_olcoach_socket_path; //!< Unix socket used instead of the online coach port, if not empty
+    bool M_ingest_thread; //!< read and decompress the dedicated client sockets on a separate thread, but parse on the simulation thread
+    bool M_output_thread; //!< send client messages and write logs on separate threads
+    int M_worker_threads; //!< number of threads that help to build the player visuals
+    int M_team_size; //!< maximum number of players on each team
 
     int M_synch_see_offset; //!< synch see offset
 
@@ -941,6 +949,14 @@ public:
     double playerSpeedMaxMin() const { return M_player_speed_max_min; }
     double extraStamina() const { return M_extra_stamina; }
     int maxMonitors() const { return M_max_monitors; }
+    bool ioUring() const { return M_io_uring; }
+    const std::string & playerSocketPath() const { return M_socket_path; }
+    const std::string & offlineCoachSocketPath() const { return M_coach_socket_path; }
+    const std::string & onlineCoachSocketPath() const { return M_olcoach_socket_path; }
+    bool ingestThread() const { return M_ingest_thread; }
+    bool outputThread() const { return M_output_thread; }
+    int workerThreads() const { return M_worker_threads; }
+    int teamSize() const { return M_team_size; }
     int synchSeeOffset() const { return M_synch_see_offset; }
     // v12.1.3
     int extraHalfTime() const { return M_extra_half_time; }
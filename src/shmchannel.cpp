@@ -0,0 +1,233 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               shmchannel.cpp
+                Shared memory message channel to a local client
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "shmchannel.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef HAVE_SHM_OPEN
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_LINUX_FUTEX_H
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+const std::size_t ShmChannel::DEFAULT_CAPACITY = 64 * 1024;
+const std::size_t ShmChannel::HEADER_SIZE = 64;
+const std::size_t ShmChannel::RING_HEADER_SIZE = MessageRing::CONTROL_SIZE;
+
+namespace {
+
+const char SHM_MAGIC[8] = { 'R', 'C', 'S', 'S', 'S', 'H', 'M', '1' };
+const std::uint32_t SERVER_CLOSED = 1;
+const std::uint32_t CLIENT_CLOSED = 2;
+const std::size_t OUTBUF_SIZE = 8192;
+
+inline
+std::uint32_t
+load_acquire( const std::uint32_t * p )
+{
+    return __atomic_load_n( p, __ATOMIC_ACQUIRE );
+}
+
+}
+
+ShmChannel::ShmChannel()
+    : M_segment( nullptr ),
+      M_segment_size( 0 ),
+      M_capacity( 0 ),
+      M_closed( nullptr ),
+      M_outbuf( nullptr ),
+      M_outbuf_size( OUTBUF_SIZE )
+{
+    M_outbuf = new char[M_outbuf_size];
+    setp( M_outbuf, M_outbuf + M_outbuf_size );
+}
+
+ShmChannel::~ShmChannel()
+{
+    close();
+    delete [] M_outbuf;
+}
+
+bool
+ShmChannel::create( const std::string & name,
+                    const std::size_t capacity )
+{
+    close();
+
+#ifdef HAVE_SHM_OPEN
+    std::uint32_t cap = 4096;
+    while ( cap < capacity )
+    {
+        cap <<= 1;
+    }
+
+    int fd = ::shm_open( name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    if ( fd < 0 && errno == EEXIST )
+    {
+        // left over from a server that did not exit cleanly
+        ::shm_unlink( name.c_str() );
+        fd = ::shm_open( name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    }
+
+    if ( fd < 0 )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error creating shared memory " << name << ": "
+                  << std::strerror( errno ) << std::endl;
+        return false;
+    }
+
+    const std::size_t size = HEADER_SIZE + 2 * ( RING_HEADER_SIZE + cap );
+    void * segment = MAP_FAILED;
+    if ( ::ftruncate( fd, size ) == 0 )
+    {
+        segment = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    }
+
+    if ( segment == MAP_FAILED )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error mapping shared memory " << name << ": "
+                  << std::strerror( errno ) << std::endl;
+        ::close( fd );
+        ::shm_unlink( name.c_str() );
+        return false;
+    }
+    ::close( fd );
+
+    M_name = name;
+    M_segment = segment;
+    M_segment_size = size;
+    M_capacity = cap;
+
+    // the new object is zero filled, so only the header has to be set
+    char * base = static_cast< char * >( segment );
+    std::memcpy( base, SHM_MAGIC, sizeof( SHM_MAGIC ) );
+    std::memcpy( base + 8, &cap, sizeof( cap ) );
+    M_closed = reinterpret_cast< std::uint32_t * >( base + 12 );
+
+    char * p = base + HEADER_SIZE;
+    M_to_client.attach( p, p + RING_HEADER_SIZE, cap );
+    p += RING_HEADER_SIZE + cap;
+    M_from_client.attach( p, p + RING_HEADER_SIZE, cap );
+
+    return true;
+#else
+    (void)name;
+    (void)capacity;
+    return false;
+#endif
+}
+
+void
+ShmChannel::close()
+{
+#ifdef HAVE_SHM_OPEN
+    if ( M_segment )
+    {
+        __atomic_fetch_or( M_closed, SERVER_CLOSED, __ATOMIC_RELEASE );
+        ::munmap( M_segment, M_segment_size );
+        ::shm_unlink( M_name.c_str() );
+    }
+#endif
+    M_segment = nullptr;
+    M_segment_size = 0;
+    M_closed = nullptr;
+    M_to_client.detach();
+    M_from_client.detach();
+    M_name.clear();
+}
+
+bool
+ShmChannel::clientClosed() const
+{
+    return M_closed
+        && ( load_acquire( M_closed ) & CLIENT_CLOSED );
+}
+
+bool
+ShmChannel::hasInput() const
+{
+    return ! M_from_client.empty();
+}
+
+bool
+ShmChannel::write( const char * msg,
+                   const std::size_t len )
+{
+    if ( ! M_to_client.write( msg, len ) )
+    {
+        return false;
+    }
+
+    if ( M_to_client.consumerSleeping() )
+    {
+#ifdef HAVE_LINUX_FUTEX_H
+        ::syscall( SYS_futex, M_to_client.seqWord(), FUTEX_WAKE, 1, nullptr, nullptr, 0 );
+#endif
+    }
+
+    return true;
+}
+
+int
+ShmChannel::read( char * buf,
+                  const std::size_t len )
+{
+    return M_from_client.read( buf, len );
+}
+
+ShmChannel::int_type
+ShmChannel::overflow( int_type c )
+{
+    sync();
+    if ( c != traits_type::eof() )
+    {
+        sputc( c );
+    }
+    return 0;
+}
+
+int
+ShmChannel::sync()
+{
+    const std::size_t size = pptr() - pbase();
+    if ( size > 0 )
+    {
+        // like a lost datagram, a message for a slow client is dropped
+        write( pbase(), size );
+    }
+    setp( M_outbuf, M_outbuf + M_outbuf_size );
+    return broken() ? -1 : 0;
+}
@@ -0,0 +1,148 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                shmchannel.h
+                Shared memory message channel to a local client
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_SHMCHANNEL_H
+#define RCSSSERVER_SHMCHANNEL_H
+
+#include <iostream>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "messagering.h"
+
+/*!
+  \class ShmChannel
+  \brief message transport to a client on the same host through a POSIX
+  shared memory segment.
+
+  The segment holds two single producer/single consumer rings, one for
+  each direction.  It is created by the server, and the client maps it
+  by the name it is told in the "(shm <name>)" message.  All fields are
+  32 bit unsigned integers in host byte order.
+
+  Segment layout:
+  - offset 0: magic "RCSSSHM1", then the ring capacity and a closed
+    flag (bit 0 set by the server, bit 1 by the client).
+  - offset HEADER_SIZE: the ring from server to client.
+  - offset HEADER_SIZE + RING_HEADER_SIZE + capacity: the ring from
+    client to server.
+
+  Each ring is a MessageRing: its control block, followed by capacity
+  bytes of data.  A client waits for messages with FUTEX_WAIT on the
+  seq word of the ring from server to client after it has set the
+  sleeping word.
+
+  For the output side the channel is a stream buffer: every sync()
+  publishes the put area as one message, like a datagram on
+  SocketStreamBuf.  A message that does not fit is dropped.  A broken
+  ring fails the sync(), so that the stream goes bad and the client is
+  dropped.
+ */
+class ShmChannel
+    : public std::streambuf {
+public:
+    static const std::size_t DEFAULT_CAPACITY;
+    static const std::size_t HEADER_SIZE;
+    static const std::size_t RING_HEADER_SIZE;
+
+private:
+    std::string M_name;
+    void * M_segment;
+    std::size_t M_segment_size;
+    std::uint32_t M_capacity;
+    std::uint32_t * M_closed;
+
+    MessageRing M_to_client;
+    MessageRing M_from_client;
+
+    char * M_outbuf;
+    std::size_t M_outbuf_size;
+
+    ShmChannel( const ShmChannel & ) = delete;
+    ShmChannel & operator=( const ShmChannel & ) = delete;
+
+public:
+    ShmChannel();
+
+    //! marks the channel closed and removes the segment
+    ~ShmChannel();
+
+    /*!
+      \brief create a new segment
+      \param name the shared memory object name, starting with '/'
+      \param capacity the size of each ring, rounded up to a power of two
+      \return true if the segment could be created and mapped
+     */
+    bool create( const std::string & name,
+                 const std::size_t capacity = DEFAULT_CAPACITY );
+
+    void close();
+
+    bool isOpen() const
+      {
+          return M_segment != nullptr;
+      }
+
+    const
+    std::string & name() const
+      {
+          return M_name;
+      }
+
+    //! true if the client has marked the channel closed
+    bool clientClosed() const;
+
+    //! true if the client has corrupted one of the rings
+    bool broken() const
+      {
+          return M_to_client.broken()
+              || M_from_client.broken();
+      }
+
+    //! true if a message from the client is waiting
+    bool hasInput() const;
+
+    /*!
+      \brief publish one message to the client
+      \return false if the ring does not have enough free space
+     */
+    bool write( const char * msg,
+                const std::size_t len );
+
+    /*!
+      \brief take the next message from the client
+      \return the size of the message, which is truncated to len bytes,
+      or -1 if there is none
+     */
+    int read( char * buf,
+              const std::size_t len );
+
+protected:
+
+    virtual
+    int_type overflow( int_type c = traits_type::eof() );
+
+    virtual
+    int sync();
+};
+
+#endif
@@ -45,6 +45,7 @@
 #include "xpmholder.h"
 
 #include <rcss/clang/clangmsg.h>
+#include <rcss/net/unixdatagramsocket.hpp>
 
 #include <sstream>
 #include <vector>
@@ -61,11 +62,26 @@
 #include <cctype>
 #include <cerrno>
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
 
 Stadium::Stadium()
     : M_alive( true ),
+      M_killed( 0 ),
+      M_poll_fds_size( 0 ),
+      M_poll_fds_count( 0 ),
+      M_poll_fds_changes( 0 ),
+      M_send_queue( &M_io_ring ),
+      M_visual_wheel( ServerParam::instance().teamSize() * 2, 16 ),
+      M_synch_visual_wheel( ServerParam::instance().teamSize() * 2, 4 ),
+      M_last_visual( ServerParam::instance().teamSize() * 2, 0 ),
       M_ball( nullptr ),
-      M_players( MAX_PLAYER*2, static_cast< Player * >( 0 ) ),
+      M_players( ServerParam::instance().teamSize() * 2, static_cast< Player * >( 0 ) ),
       M_coach( nullptr ),
       M_olcoaches( 2, static_cast< OnlineCoach * >( 0 ) ),
       M_team_l( nullptr ),
@@ -78,7 +94,14 @@ Stadium::Stadium()
       M_last_playon_start( 0 ),
       M_game_over_wait( 0 ),
       M_left_child( 0 ),
-      M_right_child( 0 )
+      M_right_child( 0 ),
+      M_long_kick_time( 0 ),
+      M_long_kick_stoppage_time( 0 ),
+      M_prev_step_time( std::chrono::system_clock::now() ),
+      M_cycles_missed( 0 ),
+      M_monitor_wait_count( 0 ),
+      M_finalized( false ),
+      M_recv_buffer( RECV_BATCH_SIZE * ( MaxMesg + 1 ) )
 {
     // !!! registration order is very important !!!
     // TODO: fix dependencies among referees.
@@ -93,11 +116,13 @@ Stadium::Stadium()
     M_referees.push_back( new KeepawayRef( *this ) );
     M_referees.push_back( new PenaltyRef( *this ) );
 
-    M_movable_objects.reserve( MAX_PLAYER*2 + 1 );
+    M_movable_objects.reserve( M_players.size() + 1 );
 }
 
 Stadium::~Stadium()
 {
+    M_output_stage.stop();
+    M_io_ring.flush();
     M_savers.clear();
 
     for ( std::list< Referee * >::iterator i = M_referees.begin();
@@ -168,6 +193,41 @@ Stadium::~Stadium()
 }
 
 
+namespace {
+/*!
+  create and bind the shared socket of one kind of client.
+  \param path Unix domain socket path, or empty to use port
+  \param port UDP port
+  \return the socket, or nullptr on error
+ */
+std::unique_ptr< rcss::net::Socket >
+open_endpoint( const std::string & path,
+               const rcss::net::Addr::PortType port )
+{
+    if ( ! path.empty() )
+    {
+        rcss::net::UnixDatagramSocket * socket = new rcss::net::UnixDatagramSocket();
+        std::unique_ptr< rcss::net::Socket > ptr( socket );
+        if ( ! socket->bindPath( rcss::net::Addr::makeUnix( path ) ) )
+        {
+            std::cerr << "Error initializing sockets: path=" << path
+                      << ". " << strerror( errno ) << std::endl;
+            return std::unique_ptr< rcss::net::Socket >();
+        }
+        return ptr;
+    }
+
+    std::unique_ptr< rcss::net::Socket > socket( new rcss::net::UDPSocket() );
+    if ( ! socket->bind( rcss::net::Addr( port ) ) )
+    {
+        std::cerr << "Error initializing sockets: port=" << port
+                  << ". " << strerror( errno ) << std::endl;
+        return std::unique_ptr< rcss::net::Socket >();
+    }
+    return socket;
+}
+}
+
 
 /*
  *===================================================================
@@ -241,6 +301,7 @@ Stadium::init()
             return false;
         }
         delete reader;
+        M_field.indexLandmarks();
     }
 
     M_player_types.push_back( new HeteroPlayer( 0 ) );
@@ -251,38 +312,80 @@ Stadium::init()
         //std::cout << *(M_player_types[i]) << std::endl;
     }
 
-    if ( ! M_player_socket.bind( rcss::net::Addr( ServerParam::instance().playerPort() )  ) )
+    M_player_socket = open_endpoint( ServerParam::instance().playerSocketPath(),
+                                     ServerParam::instance().playerPort() );
+    M_offline_coach_socket = open_endpoint( ServerParam::instance().offlineCoachSocketPath(),
+                                            ServerParam::instance().offlineCoachPort() );
+    M_online_coach_socket = open_endpoint( ServerParam::instance().onlineCoachSocketPath(),
+                                           ServerParam::instance().onlineCoachPort() );
+    if ( ! M_player_socket
+         || ! M_offline_coach_socket
+         || ! M_online_coach_socket )
     {
-        std::cerr << "Error initializing sockets: port=" << ServerParam::instance().playerPort()
-                  << ". " << strerror( errno ) << std::endl;
         disable();
         return false;
     }
 
-    if ( ! M_offline_coach_socket.bind( rcss::net::Addr( ServerParam::instance().offlineCoachPort() ) ) )
+    if ( M_player_socket->setNonBlocking() == -1
+         || M_offline_coach_socket->setNonBlocking() == -1
+         || M_online_coach_socket->setNonBlocking() == -1 )
     {
-        std::cerr << "Error initializing sockets: port=" << ServerParam::instance().offlineCoachPort()
-                  << ". " << strerror( errno ) << std::endl;
+        std::cerr << "Error setting sockets non-blocking: "
+                  << strerror( errno ) << std::endl;
         disable();
         return false;
     }
 
-    if ( ! M_online_coach_socket.bind( rcss::net::Addr( ServerParam::instance().onlineCoachPort() ) ) )
+    if ( ServerParam::instance().ioUring() )
     {
-        std::cerr << "Error initializing sockets: port=" << ServerParam::instance().onlineCoachPort()
-                  << ". " << strerror( errno ) << std::endl;
-        disable();
-        return false;
+        // room for a full sized message per entry
+        const unsigned int entries = 256;
+        if ( M_io_ring.open( entries, entries * MaxMesg ) )
+        {
+            std::cout << "Sending client messages through io_uring" << std::endl;
+        }
+        else
+        {
+            std::cerr << "io_uring is not available. Sending client messages directly."
+                      << std::endl;
+        }
     }
 
-    if ( M_player_socket.setNonBlocking() == -1
-         || M_offline_coach_socket.setNonBlocking() == -1
-         || M_online_coach_socket.setNonBlocking() == -1 )
+    if ( ServerParam::instance().outputThread() )
     {
-        std::cerr << "Error setting sockets non-blocking: "
-                  << strerror( errno ) << std::endl;
-        disable();
-        return false;
+        if ( M_output_stage.start( &M_io_ring ) )
+        {
+            std::cout << "Sending client messages on a separate thread" << std::endl;
+            M_send_queue = &M_output_stage;
+        }
+        else
+        {
+            std::cerr << "The output thread is not available. Sending client messages directly."
+                      << std::endl;
+        }
+    }
+
+    if ( ServerParam::instance().workerThreads() > 0 )
+    {
+        const std::size_t n = M_worker_pool.start( ServerParam::instance().workerThreads() );
+        std::cout << "Building player visuals with " << n << " worker threads" << std::endl;
+    }
+
+    if ( ServerParam::instance().ingestThread() )
+    {
+        if ( M_ingest.start() )
+        {
+            std::cout << "Receiving client messages on a separate thread" << std::endl;
+            M_player_poller.setIngest( &M_ingest );
+            M_offline_coach_poller.setIngest( &M_ingest );
+            M_online_coach_poller.setIngest( &M_ingest );
+            M_monitor_poller.setIngest( &M_ingest );
+        }
+        else
+        {
+            std::cerr << "The network thread is not available. Receiving client messages directly."
+                      << std::endl;
+        }
     }
 
     M_weather.init();
@@ -322,7 +425,7 @@ Stadium::checkAutoMode()
                            * ServerParam::instance().nrExtraHalfs() ) )
          )
     {
-        if ( M_remote_players.size() == MAX_PLAYER*2 || time() > 0 )
+        if ( M_remote_players.size() == M_players.size() || time() > 0 )
         {
             if ( M_kick_off_wait == ServerParam::instance().kickOffWait() )
             {
@@ -536,17 +639,27 @@ Stadium::createObjects()
     M_team_l->setPoint( ServerParam::instance().startGoalLeft() );
     M_team_r->setPoint( ServerParam::instance().startGoalRight() );
 
-    for ( int i = 0; i < MAX_PLAYER; ++i )
+    const int team_size = ServerParam::instance().teamSize();
+    for ( int i = 0; i < team_size; ++i )
     {
         Player * p_l = new Player( *this, M_team_l, i+1 );
         Player * p_r = new Player( *this, M_team_r, i+1 );
         M_team_l->assignPlayer( i, p_l );
         M_team_r->assignPlayer( i, p_r );
         M_players[i] = p_l;
-        M_players[i+MAX_PLAYER] = p_r;
+        M_players[i+team_size] = p_r;
     }
 
     M_shuffle_players = M_players;
+    M_binary_format_players.assign( MAX_PLAYER * 2, static_cast< const Player * >( 0 ) );
+    for ( int i = 0; i < std::min( team_size, MAX_PLAYER ); ++i )
+    {
+        M_binary_format_players[i] = M_players[i];
+        M_binary_format_players[i+MAX_PLAYER] = M_players[i+team_size];
+    }
+    M_distances.assign( M_players, M_ball );
+    M_collision_objects.assign( M_players.begin(), M_players.end() );
+    M_collision_objects.push_back( M_ball );
 
     M_coach = new Coach( *this );
 
@@ -624,7 +737,11 @@ Stadium::initPlayer( const char * teamname,
 
     addListener( player );
     M_remote_players.push_back( player );
+    indexClient( M_player_port_clients, addr, player );
+    M_player_poller.add( player );
+    player->setSendQueue( M_send_queue );
     M_movable_objects.push_back( player );
+    scheduleVisual( *player, true );
 
     player->setEnforceDedicatedPort( version >= 8.0 );
     player->sendInit();
@@ -639,8 +756,8 @@ Stadium::reconnectPlayer( const char * teamname,
                           const rcss::net::Addr & addr )
 
 {
-    int r = 0;
-    for ( r = 0; r < MAX_PLAYER * 2; ++r )
+    std::size_t r = 0;
+    for ( r = 0; r < M_players.size(); ++r )
     {
         if ( M_players[r]->team()->enabled()
              && M_players[r]->team()->name() == teamname
@@ -671,6 +788,10 @@ Stadium::reconnectPlayer( const char * teamname,
 
             addListener( M_players[r] );
             M_remote_players.push_back( M_players[r] );
+            indexClient( M_player_port_clients, addr, M_players[r] );
+            M_player_poller.add( M_players[r] );
+            M_players[r]->setSendQueue( M_send_queue );
+            scheduleVisual( *M_players[r], true );
 
             M_players[r]->setEnforceDedicatedPort( M_players[r]->version() >= 8.0 );
             M_players[r]->setEnable();
@@ -708,6 +829,9 @@ Stadium::initCoach( const double & version,
     }
 
     addOfflineCoach( M_coach );
+    indexClient( M_offline_coach_port_clients, addr, M_coach );
+    M_offline_coach_poller.add( M_coach );
+    M_coach->setSendQueue( M_send_queue );
     addListener( M_coach );
     M_coach->setEnforceDedicatedPort( version >= 8.0 );
     M_coach->sendInit();
@@ -766,6 +890,9 @@ Stadium::initOnlineCoach( const char * teamname,
     addListener( olc );
 
     M_remote_online_coaches.push_back( olc );
+    indexClient( M_online_coach_port_clients, addr, olc );
+    M_online_coach_poller.add( olc );
+    olc->setSendQueue( M_send_queue );
 
     olc->sendInit();
 
@@ -911,6 +1038,7 @@ Stadium::incMovableObjects()
 {
     std::shuffle( M_movable_objects.begin(), M_movable_objects.end(),
                   DefaultRNG::instance() );
+    M_kinematics.accelerate( M_movable_objects, weather() );
     for ( MPObjectCont::reference o : M_movable_objects )
     {
         if ( o->isEnabled() )
@@ -1004,7 +1132,7 @@ Stadium::placePlayersInField()
                                      ServerParam::PITCH_WIDTH
                                      + ServerParam::PITCH_MARGIN*2.0 ) );
 
-    for ( int i = 0; i < MAX_PLAYER * 2; ++i )
+    for ( std::size_t i = 0; i < M_players.size(); ++i )
     {
         if ( ! M_players[i]->isEnabled() ) continue;
 
@@ -1029,13 +1157,19 @@ Stadium::getPlayer( const Side side,
 //         }
 //     }
 
+    const int team_size = ServerParam::instance().teamSize();
+    if ( unum < 1 || team_size < unum )
+    {
+        return static_cast< Player * >( 0 );
+    }
+
     if ( side == LEFT )
     {
         return M_players[unum - 1];
     }
     else if ( side == RIGHT )
     {
-        return M_players[MAX_PLAYER + unum - 1];
+        return M_players[team_size + unum - 1];
     }
 
     return static_cast< Player * >( 0 );
@@ -1385,7 +1519,7 @@ Stadium::movePlayer( const Side side,
                      const double * ang,
                      const PVector * vel )
 {
-    if ( unum < 1 || MAX_PLAYER < unum )
+    if ( unum < 1 || ServerParam::instance().teamSize() < unum )
     {
         if ( ServerParam::instance().verboseMode() )
             std::cerr << "No such player. " << SideStr( side )
@@ -1514,7 +1648,7 @@ Stadium::broadcastSubstitution( const int side,
     snprintf( enemies, 64, "(change_player_type %d)", unum );
 
     // tell players
-    for ( int i = 0 ; i < MAX_PLAYER * 2; ++i )
+    for ( std::size_t i = 0 ; i < M_players.size(); ++i )
     {
         if ( ! M_players[i]->isEnabled() ) continue;
         if ( M_players[i]->version() < 7.0 ) continue;
@@ -1611,7 +1745,7 @@ Stadium::broadcastChangePlayerToGoalie( const Player * player )
               player->unum() );
 
     // tell players
-    for ( int i = 0 ; i < MAX_PLAYER * 2; ++i )
+    for ( std::size_t i = 0 ; i < M_players.size(); ++i )
     {
         if ( M_players[i]->isEnabled()
              && M_players[i]->version() >= 16.0 )
@@ -1660,9 +1794,26 @@ Stadium::collisions()
             p->clearCollision();
         }
 
+        //
+        // only the pairs found by the broadphase can collide.  they are
+        // sorted, so they are handled in the same order as a loop over
+        // all pairs would, with the ball, which comes last, after the
+        // players.
+        //
+        M_broadphase.findPairs( M_collision_objects, M_contacts );
+        const std::vector< Broadphase::Pair >::const_iterator ball_contacts
+            = std::stable_partition( M_contacts.begin(), M_contacts.end(),
+                                     [&]( const Broadphase::Pair & c )
+                                     {
+                                         return c.second != SIZE;
+                                     } );
+
         // check ball to player
-        for ( PlayerCont::reference p : M_players )
+        for ( std::vector< Broadphase::Pair >::const_iterator c = ball_contacts;
+              c != M_contacts.end();
+              ++c )
         {
+            Player * p = M_players[c->first];
             if ( p->isEnabled()
                  && p != M_ball_catcher
                  && M_ball->pos().distance2( p->pos() ) < std::pow( M_ball->size() + p->size(), 2 ) )
@@ -1680,19 +1831,20 @@ Stadium::collisions()
         }
 
         // check player to player
-        for ( std::size_t i = 0; i < SIZE - 1; ++i )
-        {
-            for ( std::size_t j = i + 1; j < SIZE; ++j )
+        for ( std::vector< Broadphase::Pair >::const_iterator c = M_contacts.begin();
+              c != ball_contacts;
+              ++c )
+        {
+            Player * a = M_players[c->first];
+            Player * b = M_players[c->second];
+            if ( a->isEnabled()
+                 && b->isEnabled()
+                 && a->pos().distance2( b->pos() ) < std::pow( a->size() + b->size(), 2 ) )
             {
-                if ( M_players[i]->isEnabled()
-                     && M_players[j]->isEnabled()
-                     && M_players[i]->pos().distance2( M_players[j]->pos() ) < std::pow( M_players[i]->size() + M_players[j]->size(), 2 ) )
-                {
-                    col = true;
-                    M_players[i]->collidedWithPlayer();
-                    M_players[j]->collidedWithPlayer();
-                    calcCollisionPos( M_players[i], M_players[j] );
-                }
+                col = true;
+                a->collidedWithPlayer();
+                b->collidedWithPlayer();
+                calcCollisionPos( a, b );
             }
         }
 
@@ -1827,7 +1979,7 @@ Stadium::setPlayerState( const Side side,
                          const int unum,
                          const int state )
 {
-    if ( unum < 1 || MAX_PLAYER < unum )
+    if ( unum < 1 || ServerParam::instance().teamSize() < unum )
     {
         if ( ServerParam::instance().verboseMode() )
         {
@@ -1978,6 +2130,117 @@ Stadium::sendTeamGraphic( const Side side,
 }
 
 
+void
+Stadium::indexClient( ClientIndex & index,
+                      const rcss::net::Addr & addr,
+                      RemoteClient * client )
+{
+    // a reconnecting client may still be registered with its old address
+    unindexClient( index, client );
+    index[ addr ] = client;
+}
+
+void
+Stadium::unindexClient( ClientIndex & index,
+                        const RemoteClient * client )
+{
+    // the peer address of a disconnected client is not available anymore,
+    // so the entry has to be looked up by value.
+    for ( ClientIndex::iterator it = index.begin();
+          it != index.end(); )
+    {
+        if ( it->second == client )
+        {
+            it = index.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+RemoteClient *
+Stadium::findClient( ClientIndex & index,
+                     const rcss::net::Addr & addr )
+{
+    ClientIndex::iterator it = index.find( addr );
+    if ( it == index.end() )
+    {
+        return nullptr;
+    }
+
+    if ( it->second->getDest() != addr )
+    {
+        // the client has been disconnected since it was registered
+        index.erase( it );
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+void
+Stadium::flushOutput()
+{
+    if ( M_output_stage.isRunning() )
+    {
+        M_output_stage.publish();
+    }
+    else
+    {
+        M_io_ring.flush();
+    }
+
+    // the output thread reports the failures of earlier batches
+    M_send_queue->takeFailures( M_send_failures );
+    if ( ! M_send_failures.empty() )
+    {
+        closeFailedClients();
+    }
+}
+
+namespace {
+/*!
+  find the connected client in clients that sends on fd.
+ */
+template < typename Cont >
+RemoteClient *
+find_client_by_fd( const Cont & clients,
+                   const int fd )
+{
+    for ( RemoteClient * c : clients )
+    {
+        if ( c->connected()
+             && c->getFD() == fd )
+        {
+            return c;
+        }
+    }
+    return nullptr;
+}
+}
+
+void
+Stadium::closeFailedClients()
+{
+    for ( const rcss::net::SendFailure & f : M_send_failures )
+    {
+        RemoteClient * client = find_client_by_fd( M_remote_players, f.fd_ );
+        if ( ! client ) client = find_client_by_fd( M_remote_offline_coaches, f.fd_ );
+        if ( ! client ) client = find_client_by_fd( M_remote_online_coaches, f.fd_ );
+        if ( ! client ) client = find_client_by_fd( M_monitors, f.fd_ );
+
+        // the client is removed by the next removeDisconnectedClients()
+        if ( client )
+        {
+            client->sendFailed( f.err_ );
+        }
+    }
+
+    M_send_failures.clear();
+}
+
 void
 Stadium::removeDisconnectedClients()
 {
@@ -1988,6 +2251,8 @@ Stadium::removeDisconnectedClients()
         {
             (*i)->disable();
             removeListener( *i );
+            unindexClient( M_player_port_clients, *i );
+            M_player_poller.remove( *i );
             i = M_remote_players.erase( i );
         }
         else
@@ -2003,6 +2268,8 @@ Stadium::removeDisconnectedClients()
         {
             (*i)->disable();
             removeListener( *i );
+            unindexClient( M_offline_coach_port_clients, *i );
+            M_offline_coach_poller.remove( *i );
             i = M_remote_offline_coaches.erase( i );
         }
         else
@@ -2018,6 +2285,8 @@ Stadium::removeDisconnectedClients()
         {
             (*i)->disable();
             removeListener( *i );
+            unindexClient( M_online_coach_port_clients, *i );
+            M_online_coach_poller.remove( *i );
             i = M_remote_online_coaches.erase( i );
         }
         else
@@ -2031,6 +2300,8 @@ Stadium::removeDisconnectedClients()
     {
         if ( ! (*i)->connected() )
         {
+            unindexClient( M_player_port_clients, *i );
+            M_monitor_poller.remove( *i );
             delete *i;
             i = M_monitors.erase( i );
             std::cout << "A monitor disconnected\n";
@@ -2049,6 +2320,8 @@ Stadium::sendRefereeAudio( const char * msg )
     std::shuffle( M_listeners.begin(), M_listeners.end(),
                   DefaultRNG::instance() );
 
+    M_broadcast_cache.clear();
+
     // the following should work, but I haven't tested it yet
     //      std::for_each( M_listeners.begin(), M_listeners.end(),
     //                     std::bind2nd( std::mem_fun( &rcss::Listener::sendRefereeAudio ),
@@ -2151,6 +2424,8 @@ Stadium::sendCoachStdAudio( const OnlineCoach & coach,
     std::shuffle( M_listeners.begin(), M_listeners.end(),
                   DefaultRNG::instance() );
 
+    M_broadcast_cache.clear();
+
     for ( ListenerCont::reference l : M_listeners )
     {
         l->sendCoachStdAudio( msg );
@@ -2187,19 +2462,16 @@ Stadium::sendCoachStdAudio( const OnlineCoach & coach,
 void
 Stadium::doRecvFromClients()
 {
-    static int s_time = 0;
-    static int s_stoppage_time = 0;
-
     const std::chrono::system_clock::time_point start_time = std::chrono::system_clock::now();
 
     //
     // delayed effects
     //
-    if ( s_time != M_time
-         && s_stoppage_time != M_stoppage_time )
+    if ( M_long_kick_time != M_time
+         && M_long_kick_stoppage_time != M_stoppage_time )
     {
-        s_time = M_time;
-        s_stoppage_time = M_stoppage_time;
+        M_long_kick_time = M_time;
+        M_long_kick_stoppage_time = M_stoppage_time;
 
         std::shuffle( M_shuffle_players.begin(), M_shuffle_players.end(),
                       DefaultRNG::instance() );
@@ -2218,6 +2490,10 @@ Stadium::doRecvFromClients()
 
     removeDisconnectedClients();
 
+    // the replies to the commands, e.g. init, ok and error, must not
+    // wait for the next timer event
+    flushOutput();
+
     const std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
     Logger::instance().writeProfile( *this, start_time, end_time, "RECV" );
 }
@@ -2225,15 +2501,14 @@ Stadium::doRecvFromClients()
 void
 Stadium::doNewSimulatorStep()
 {
-    static std::chrono::system_clock::time_point prev_time = std::chrono::system_clock::now();
     const std::chrono::system_clock::time_point start_time = std::chrono::system_clock::now();
 
     // th 6.3.00
     //  tp_old = tp_new;
     //  write_times displays nonsense at first call, since tp_old is never
     //  initialized. Don't want to handle special exception for first call.
-    Logger::instance().writeTimes( *this, prev_time, start_time );
-    prev_time = start_time;
+    Logger::instance().writeTimes( *this, M_prev_step_time, start_time );
+    M_prev_step_time = start_time;
 
     //
     // step
@@ -2242,6 +2517,8 @@ Stadium::doNewSimulatorStep()
     startTeams();
     checkAutoMode();
 
+    flushOutput();
+
     const std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
     Logger::instance().writeProfile( *this, start_time, end_time, "SIM" );
 }
@@ -2290,6 +2567,8 @@ Stadium::doSendSenseBody()
     //
     // write profile
     //
+    flushOutput();
+
     const std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
     Logger::instance().writeProfile( *this, start_time, end_time, "SB" );
 }
@@ -2299,39 +2578,115 @@ Stadium::doSendVisuals()
 {
     const std::chrono::system_clock::time_point start_time = std::chrono::system_clock::now();
 
-    std::shuffle( M_remote_players.begin(), M_remote_players.end(),
-                  DefaultRNG::instance() );
+    sendPlayerVisuals( M_visual_wheel, &Player::sendVisual );
 
-    for ( PlayerCont::reference p : M_remote_players )
-    {
-        if ( p->isEnabled()
-             && p->connected() )
-        {
-            p->sendVisual();
-        }
-    }
+    flushOutput();
 
     const std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
     Logger::instance().writeProfile( *this, start_time, end_time, "VIS" );
 }
 
 void
-Stadium::doSendSynchVisuals()
+Stadium::scheduleVisual( const Player & player,
+                         const bool restart )
 {
-    const std::chrono::system_clock::time_point start_time = std::chrono::system_clock::now();
+    const std::size_t i = M_distances.index( player );
+    TimingWheel & wheel = ( player.isSynchSee()
+                            ? M_synch_visual_wheel
+                            : M_visual_wheel );
+    TimingWheel & other = ( player.isSynchSee()
+                            ? M_visual_wheel
+                            : M_synch_visual_wheel );
 
-    std::shuffle( M_remote_players.begin(), M_remote_players.end(),
+    if ( restart )
+    {
+        other.cancel( i );
+        M_last_visual[i] = wheel.now();
+    }
+    else if ( other.scheduled( i ) )
+    {
+        // the ticks counted since the last visual carry over
+        M_last_visual[i] = wheel.now() - ( other.now() - M_last_visual[i] );
+        other.cancel( i );
+    }
+
+    wheel.schedule( i, M_last_visual[i] + player.visualSendInterval() );
+}
+
+void
+Stadium::sendPlayerVisuals( TimingWheel & wheel,
+                            void ( Player::*send )() )
+{
+    //
+    // only the players whose visual is due are visited.  a disabled
+    // player does not count the ticks, so its visual is put off by
+    // one tick.
+    //
+    wheel.advance( M_due_visuals );
+
+    M_visual_targets.clear();
+    for ( const std::size_t i : M_due_visuals )
+    {
+        Player * p = M_players[i];
+        if ( ! p->connected() )
+        {
+            continue;
+        }
+
+        if ( ! p->isEnabled() )
+        {
+            ++M_last_visual[i];
+            wheel.schedule( i, wheel.now() + 1 );
+            continue;
+        }
+
+        M_last_visual[i] = wheel.now();
+        wheel.schedule( i, wheel.now() + p->visualSendInterval() );
+        M_visual_targets.push_back( p );
+    }
+
+    std::shuffle( M_visual_targets.begin(), M_visual_targets.end(),
                   DefaultRNG::instance() );
 
-    for ( PlayerCont::reference p : M_remote_players )
+    if ( M_worker_pool.size() == 0 )
     {
-        if ( p->isEnabled()
-             && p->connected() )
+        for ( Player * p : M_visual_targets )
         {
-            p->sendSynchVisual();
+            ( p->*send )();
         }
+        return;
     }
 
+    //
+    // build the messages in parallel, each into the memory of its
+    // player, and send them in the shuffled order afterwards.
+    //
+    for ( Player * p : M_visual_targets )
+    {
+        p->deferOutput();
+    }
+
+    M_worker_pool.run( M_visual_targets.size(),
+                       [this, send]( const std::size_t i )
+                       {
+                           ( M_visual_targets[i]->*send )();
+                       } );
+
+    for ( Player * p : M_visual_targets )
+    {
+        p->commitOutput();
+    }
+}
+
+void
+Stadium::doSendSynchVisuals()
+{
+    const std::chrono::system_clock::time_point start_time = std::chrono::system_clock::now();
+
+    sendPlayerVisuals( M_synch_visual_wheel, &Player::sendSynchVisual );
+
+    flushOutput();
+
     const std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
     Logger::instance().writeProfile( *this, start_time, end_time, "VIS_S" );
 }
@@ -2355,6 +2710,8 @@ Stadium::doSendCoachMessages()
         }
     }
 
+    flushOutput();
+
     const std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
     Logger::instance().writeProfile( *this, start_time, end_time, "COACH" );
 
@@ -2393,8 +2750,6 @@ Stadium::doSendThink()
     const double max_msec_waited = 25 * 50;
     const int max_cycles_missed = 20;
 
-    static int cycles_missed = 0; //number of cycles where someone missed
-
     bool shutdown = false;
 
     if ( time() <= 0 )
@@ -2406,10 +2761,9 @@ Stadium::doSendThink()
     }
     else if ( ! monitors().empty() )
     {
-        static int monitor_wait_count = 0;
-        if ( ++monitor_wait_count >= 32 )
+        if ( ++M_monitor_wait_count >= 32 )
         {
-            monitor_wait_count = 0;
+            M_monitor_wait_count = 0;
             std::chrono::microseconds sleep_count( 20 * 1000 );
             std::this_thread::sleep_for( sleep_count );
             //usleep( 20 * 1000 );
@@ -2417,34 +2771,40 @@ Stadium::doSendThink()
     }
 
     //figure out who we are going to wait for
-    bool wait_players[MAX_PLAYER*2];
-    for ( int i = 0; i < MAX_PLAYER*2; ++i )
+    PlayerCont wait_players;
+    for ( Player * p : M_players )
     {
-        wait_players[i] = M_players[i]->isEnabled();
+        if ( p->isEnabled() )
+        {
+            wait_players.push_back( p );
+        }
     }
 
-    bool wait_coach[2];
-    for ( int i = 0; i < 2; ++i )
+    OnlineCoachCont wait_coaches;
+    for ( OnlineCoach * c : M_olcoaches )
     {
-        wait_coach[i] = M_olcoaches[i]->isEyeOn();
+        if ( c->isEyeOn() )
+        {
+            wait_coaches.push_back( c );
+        }
     }
 
     bool wait_trainer = M_coach->isEyeOn();
 
     //tell the clients they should start thinking
-    for ( int i = 0; i < MAX_PLAYER*2; ++i )
+    for ( Player * p : wait_players )
     {
-        if ( wait_players[i] && M_players[i]->connected() )
+        if ( p->connected() )
         {
-            M_players[i]->send( think_command );
+            p->send( think_command );
         }
     }
 
-    for ( int i = 0; i < 2; ++i )
+    for ( OnlineCoach * c : wait_coaches )
     {
-        if ( wait_coach[i] && M_olcoaches[i]->connected() )
+        if ( c->connected() )
         {
-            M_olcoaches[i]->send( think_command );
+            c->send( think_command );
         }
     }
 
@@ -2454,7 +2814,42 @@ Stadium::doSendThink()
         M_coach->send( think_command );
     }
 
-    //wait for confirmations from the clients
+    flushOutput();
+
+    //wait for confirmations from the clients.
+    // the containers only keep the clients whose (done) is outstanding,
+    // so the wait ends as soon as the last one has been received.
+    auto count_outstanding = [&]() -> std::size_t
+        {
+            wait_players.erase( std::remove_if( wait_players.begin(), wait_players.end(),
+                                                []( const Player * p )
+                                                {
+                                                    return ! p->connected()
+                                                        || p->doneReceived()
+                                                        || ! p->isEnabled();
+                                                } ),
+                                wait_players.end() );
+            wait_coaches.erase( std::remove_if( wait_coaches.begin(), wait_coaches.end(),
+                                                []( const OnlineCoach * c )
+                                                {
+                                                    return ! c->connected()
+                                                        || c->doneReceived()
+                                                        || ! c->assigned();
+                                                } ),
+                                wait_coaches.end() );
+            if ( wait_trainer
+                 && ( ! M_coach->connected()
+                      || M_coach->doneReceived() ) )
+            {
+                wait_trainer = false;
+            }
+
+            return wait_players.size()
+                + wait_coaches.size()
+                + ( wait_trainer ? 1 : 0 );
+        };
+
+    std::size_t outstanding = count_outstanding();
 
     enum {
         DS_FALSE = 0,
@@ -2469,70 +2864,54 @@ Stadium::doSendThink()
     do
     {
         done = DS_TRUE;
-        ++num_sleeps;
-
-        std::chrono::microseconds sleep_count( ServerParam::instance().synchMicroSleep() );
-        std::this_thread::sleep_for( sleep_count );
-        //usleep( ServerParam::instance().synchMicroSleep() );
 
-        doRecvFromClients();
+        // get time differnce with start of loop, first get time difference in
+        // seconds, then multiply with 1000 to get msec.
+        std::chrono::nanoseconds nano_diff = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::system_clock::now() - start_time );
+        double time_diff = nano_diff.count() * 0.001 * 0.001;
 
-        for ( int i = 0; i < MAX_PLAYER*2; ++i )
+        if ( outstanding > 0 )
         {
-            if ( wait_players[i]
-                 && M_players[i]->connected()
-                 && ! M_players[i]->doneReceived()
-                 && M_players[i]->isEnabled() )
-            {
-                done = DS_FALSE;
-                break;
-            }
+            // block until one of the clients has sent something
+            ++num_sleeps;
+            waitForClientMessages( static_cast< int >( std::ceil( std::max( 0.0, max_msec_waited - time_diff ) ) ) );
         }
 
-        for ( int i = 0; i < 2; ++i )
-        {
-            if ( wait_coach[i]
-                 && M_olcoaches[i]->connected()
-                 && ! M_olcoaches[i]->doneReceived()
-                 && M_olcoaches[i]->assigned() )
-            {
-                done = DS_FALSE;
-                break;
-            }
-        }
+        // always receive at least once, since this is where new clients
+        // are accepted in synch mode.
+        doRecvFromClients();
 
-        if ( wait_trainer
-             && M_coach->connected()
-             && ! M_coach->doneReceived() )
+        outstanding = count_outstanding();
+        if ( outstanding > 0 )
         {
             done = DS_FALSE;
         }
 
-        // get time differnce with start of loop, first get time difference in
-        // seconds, then multiply with 1000 to get msec.
-        const std::chrono::nanoseconds nano_diff = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::system_clock::now() - start_time );
-        const double time_diff = nano_diff.count() * 0.001 * 0.001;
+        nano_diff = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::system_clock::now() - start_time );
+        time_diff = nano_diff.count() * 0.001 * 0.001;
 
-        if ( time_diff > max_msec_waited )
+        if ( done == DS_FALSE
+             && time_diff > max_msec_waited )
         {
             done = DS_TRUE_BUT_INCOMPLETE;
             if ( time() > 0 )
             {
-                ++cycles_missed;
+                ++M_cycles_missed;
                 std::cerr << "Someone missed a cycle at " << time() << std::endl;
             }
-            if ( cycles_missed > max_cycles_missed )
+            if ( M_cycles_missed > max_cycles_missed )
             {
                 std::cerr << "Waiting too long for clients! Exiting" << std::endl;
                 shutdown = true;
             }
         }
     }
-    while ( done == DS_FALSE );
+    while ( done == DS_FALSE
+            && ! M_killed );
 
     if ( done != DS_TRUE_BUT_INCOMPLETE )
     {
-        cycles_missed = 0;
+        M_cycles_missed = 0;
     }
 
     if ( ServerParam::instance().logTimes() )
@@ -2553,14 +2932,19 @@ Stadium::doSendThink()
 
 
 namespace {
-template < class T >
+/*!
+  receive all pending messages of the clients in poller that have input,
+  in random order.
+ */
 void
-recv_from_clients( std::vector< T > & clients )
+recv_from_clients( ClientPoller & poller )
 {
+    std::vector< RemoteClient * > & clients = poller.readyClients();
+
     std::shuffle( clients.begin(), clients.end(),
                   DefaultRNG::instance() );
 
-    for ( typename std::vector< T >::iterator i = clients.begin();
+    for ( std::vector< RemoteClient * >::iterator i = clients.begin();
           i != clients.end(); )
     {
         if ( (*i)->recv() == -1 )
@@ -2573,51 +2957,166 @@ recv_from_clients( std::vector< T > & clients )
 
 
 void
-Stadium::udp_recv_message()
+Stadium::waitForClientMessages( const int timeout_msec )
 {
-    recv_from_clients( M_remote_players );
-    recv_from_clients( M_monitors );
+#ifdef HAVE_POLL_H
+    int timeout = timeout_msec;
+    if ( M_player_poller.hasSharedMemoryClients() )
+    {
+        // messages written to shared memory do not wake up poll()
+        timeout = std::min( timeout, 1 );
+    }
 
-    while ( 1 )
+    const unsigned long changes = M_player_poller.changes()
+        + M_online_coach_poller.changes()
+        + M_offline_coach_poller.changes()
+        + M_monitor_poller.changes();
+    if ( ! M_poll_fds
+         || changes != M_poll_fds_changes )
     {
-        char message[MaxMesg];
-        std::memset( &message, 0, sizeof( char ) * MaxMesg );
+        buildPollFDs();
+        M_poll_fds_changes = changes;
+    }
 
-        rcss::net::Addr cli_addr;
+    const int n = ::poll( M_poll_fds.get(), M_poll_fds_count, timeout );
+    if ( n < 0
+         && errno != EINTR )
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error polling sockets: "
+                  << std::strerror( errno ) << std::endl;
+    }
+
+    for ( std::size_t i = 0; n > 0 && i < M_poll_fds_count; ++i )
+    {
+        if ( M_poll_fds[i].revents & POLLNVAL )
+        {
+            // a client socket has been closed before the client was removed
+            M_poll_fds.reset();
+            break;
+        }
+    }
 
-        int len = M_player_socket.recv( message, MaxMesg, cli_addr );
+    // every inbox is checked by the receive step that follows
+    M_ingest.clearNotification();
+#else
+    (void)timeout_msec;
+    std::chrono::microseconds sleep_count( ServerParam::instance().synchMicroSleep() );
+    std::this_thread::sleep_for( sleep_count );
+#endif
+}
 
-        if ( len > 0 )
+void
+Stadium::buildPollFDs()
+{
+#ifdef HAVE_POLL_H
+    std::vector< pollfd > fds;
+
+    const auto add_fd = [&fds]( const rcss::net::Socket::SocketDesc fd )
         {
-            //              std::cerr << "Got: ";
-            //              std::cerr.write( message, iMsgLength );
-            //              std::cerr << std::endl;
+            if ( fd != rcss::net::Socket::INVALIDSOCKET )
+            {
+                pollfd p = { fd, POLLIN | POLLPRI, 0 };
+                fds.push_back( p );
+            }
+        };
 
-            bool found = false;
-            for ( PlayerCont::reference p : M_remote_players )
+    const auto add_poller = [&add_fd]( const ClientPoller & poller )
+        {
+            if ( poller.getFD() >= 0 )
+            {
+                // the epoll descriptor is readable if any client is
+                add_fd( poller.getFD() );
+            }
+            else
             {
-                if ( p->getDest() == cli_addr )
+                for ( const RemoteClient * c : poller.clients() )
                 {
-                    p->undedicatedRecv( message, len );
-                    found = true;
-                    break;
+                    add_fd( c->getFD() );
                 }
             }
+        };
+
+    add_fd( M_player_socket->getFD() );
+    add_fd( M_online_coach_socket->getFD() );
+    add_fd( M_offline_coach_socket->getFD() );
+
+    add_poller( M_player_poller );
+    add_poller( M_online_coach_poller );
+    add_poller( M_offline_coach_poller );
+    add_poller( M_monitor_poller );
+
+    // becomes readable when the network thread has queued messages
+    add_fd( M_ingest.getFD() );
+
+    if ( ! M_poll_fds
+         || M_poll_fds_size < fds.size() )
+    {
+        M_poll_fds_size = std::max( fds.size(), static_cast< std::size_t >( 1 ) );
+        M_poll_fds.reset( new pollfd[M_poll_fds_size] );
+    }
+    std::copy( fds.begin(), fds.end(), M_poll_fds.get() );
+    M_poll_fds_count = fds.size();
+#endif
+}
 
-            if ( ! found )
+int
+Stadium::recvDatagrams( rcss::net::Socket & socket )
+{
+    // each datagram slot has one extra byte, so that the parsers can
+    // always null terminate the message in place.
+    const int n = socket.recvBatch( M_recv_buffer.data(), MaxMesg + 1,
+                                    RECV_BATCH_SIZE,
+                                    M_recv_sizes, M_recv_addrs );
+    if ( n < 0 )
+    {
+        if ( errno != EWOULDBLOCK )
+        {
+            std::cerr << __FILE__ << ": " << __LINE__
+                      << ": Error recv'ing from socket: "
+                      << std::strerror( errno ) << std::endl;
+        }
+        return 0;
+    }
+
+    for ( int i = 0; i < n; ++i )
+    {
+        M_recv_sizes[i] = std::min( M_recv_sizes[i], MaxMesg );
+    }
+
+    return n;
+}
+
+void
+Stadium::udp_recv_message()
+{
+    recv_from_clients( M_player_poller );
+    recv_from_clients( M_monitor_poller );
+
+    for ( ; ; )
+    {
+        const int n = recvDatagrams( *M_player_socket );
+
+        for ( int i = 0; i < n; ++i )
+        {
+            char * message = datagram( i );
+            int len = M_recv_sizes[i];
+            const rcss::net::Addr & cli_addr = M_recv_addrs[i];
+
+            if ( len <= 0 )
             {
-                for ( MonitorCont::reference m : M_monitors )
-                {
-                    if ( m->getDest() == cli_addr )
-                    {
-                        m->undedicatedRecv( message, len );
-                        found = true;
-                        break;
-                    }
-                }
+                continue;
             }
 
-            if ( ! found )
+            //              std::cerr << "Got: ";
+            //              std::cerr.write( message, iMsgLength );
+            //              std::cerr << std::endl;
+
+            if ( RemoteClient * client = findClient( M_player_port_clients, cli_addr ) )
+            {
+                client->undedicatedRecv( message, len );
+            }
+            else
             {
                 // a new monitor or a new player
 
@@ -2634,14 +3133,8 @@ Stadium::udp_recv_message()
                 }
             }
         }
-        else if ( errno != EWOULDBLOCK )
-        {
-            std::cerr << __FILE__ << ": " << __LINE__
-                      << ": Error recv'ing from socket: "
-                      << std::strerror( errno ) << std::endl;
-        }
 
-        if ( len < 0 )
+        if ( n < static_cast< int >( RECV_BATCH_SIZE ) )
         {
             break;
         }
@@ -2659,13 +3152,14 @@ Stadium::parsePlayerInit( const char * message,
     //
     if ( ! std::strncmp( message, "(init ", std::strlen( "(init " ) ) )
     {
-        // (init <TeamName> [(version <Ver>)][ (goalie)])
+        // (init <TeamName> [(version <Ver>)][ (goalie)][ (shm)])
 
         const char * msg = message;
 
         char teamname[16];
         double version = 3.0;
         bool goalie = false;
+        bool shm = false;
 
         int n_read = 0;
         if ( std::sscanf( msg, " ( init %15[+-_a-zA-Z0-9] %n ",
@@ -2704,6 +3198,11 @@ Stadium::parsePlayerInit( const char * message,
                 goalie = true;
                 msg += std::strlen( "(goalie)" );
             }
+            else if ( ! std::strncmp( msg, "(shm)", std::strlen( "(shm)" ) ) )
+            {
+                shm = true;
+                msg += std::strlen( "(shm)" );
+            }
             else
             {
                 sendToPlayer( "(error illegal_command_form)", cli_addr );
@@ -2727,6 +3226,11 @@ Stadium::parsePlayerInit( const char * message,
                       << std::endl;
 
             Logger::instance().writePlayerLog( *this, *p, message, RECV );
+
+            if ( shm )
+            {
+                openSharedMemory( p );
+            }
         }
 
         return;
@@ -2768,6 +3272,27 @@ Stadium::parsePlayerInit( const char * message,
 }
 
 
+void
+Stadium::openSharedMemory( Player * player )
+{
+    std::ostringstream name;
+    name << "/rcssserver-"
+#ifdef HAVE_UNISTD_H
+         << ::getpid() << '-'
+#endif
+         << SideStr( player->side() ) << '-' << player->unum();
+
+    if ( ! player->openSharedMemory( name.str() ) )
+    {
+        player->send( "(warning shm_not_available)" );
+        return;
+    }
+
+    // the player is now read from its rings instead of its socket
+    M_player_poller.add( player );
+}
+
+
 bool
 Stadium::parseMonitorInit( const char * message,
                            const rcss::net::Addr & addr )
@@ -2803,6 +3328,9 @@ Stadium::parseMonitorInit( const char * message,
 
         mon->setEnforceDedicatedPort( ver >= 2.0 );
         M_monitors.push_back( mon );
+        indexClient( M_player_port_clients, addr, mon );
+        M_monitor_poller.add( mon );
+        mon->setSendQueue( M_send_queue );
 
         // send server parameter information to monitor
         mon->sendInit();
@@ -2820,38 +3348,35 @@ Stadium::udp_recv_from_coach()
 
     if ( allow_coach )
     {
-        recv_from_clients( M_remote_offline_coaches );
+        recv_from_clients( M_offline_coach_poller );
     }
 
-    while ( 1 )
+    for ( ; ; )
     {
-        char message[MaxMesg];
-        std::memset( &message, 0, sizeof( char ) * MaxMesg );
+        const int n = recvDatagrams( *M_offline_coach_socket );
 
-        rcss::net::Addr cli_addr;
+        for ( int i = 0; i < n; ++i )
+        {
+            char * message = datagram( i );
+            int len = M_recv_sizes[i];
+            const rcss::net::Addr & cli_addr = M_recv_addrs[i];
 
-        int len = M_offline_coach_socket.recv( message, MaxMesg,  cli_addr );
+            if ( len <= 0 )
+            {
+                continue;
+            }
 
-        if ( len > 0 )
-        {
             if ( ! allow_coach )
             {
                 sendToCoach( "(error connected_offline_coach_without_coach_mode)", cli_addr );
                 continue;
             }
 
-            bool found = false;
-            for ( OfflineCoachCont::reference c : M_remote_offline_coaches )
+            if ( RemoteClient * client = findClient( M_offline_coach_port_clients, cli_addr ) )
             {
-                if ( c->getDest() == cli_addr )
-                {
-                    c->undedicatedRecv( message, len );
-                    found = true;
-                    break;
-                }
+                client->undedicatedRecv( message, len );
             }
-
-            if ( ! found )
+            else
             {
                 // a new offline coach
 
@@ -2865,14 +3390,8 @@ Stadium::udp_recv_from_coach()
                 parseCoachInit( message, cli_addr );
             }
         }
-        else if ( errno != EWOULDBLOCK )
-        {
-            std::cerr << __FILE__ << ": " << __LINE__
-                      << ": Error recv'ing from socket: "
-                      << strerror( errno ) << std::endl;
-        }
 
-        if ( len < 0 )
+        if ( n < static_cast< int >( RECV_BATCH_SIZE ) )
         {
             break;
         }
@@ -2932,31 +3451,28 @@ Stadium::parseCoachInit( const char * message,
 void
 Stadium::udp_recv_from_online_coach()
 {
-    recv_from_clients( M_remote_online_coaches );
+    recv_from_clients( M_online_coach_poller );
 
-    while ( 1 )
+    for ( ; ; )
     {
-        char message[MaxMesg];
-        std::memset( &message, 0, sizeof ( char ) * MaxMesg );
-
-        rcss::net::Addr cli_addr;
+        const int n = recvDatagrams( *M_online_coach_socket );
 
-        int len = M_online_coach_socket.recv( message, MaxMesg, cli_addr );
-
-        if ( len > 0 )
+        for ( int i = 0; i < n; ++i )
         {
-            bool found = false;
-            for ( OnlineCoachCont::reference c : M_remote_online_coaches )
+            char * message = datagram( i );
+            int len = M_recv_sizes[i];
+            const rcss::net::Addr & cli_addr = M_recv_addrs[i];
+
+            if ( len <= 0 )
             {
-                if ( c->getDest() == cli_addr )
-                {
-                    c->undedicatedRecv( message, len );
-                    found = true;
-                    break;
-                }
+                continue;
             }
 
-            if ( ! found )
+            if ( RemoteClient * client = findClient( M_online_coach_port_clients, cli_addr ) )
+            {
+                client->undedicatedRecv( message, len );
+            }
+            else
             {
                 // a new online coach
 
@@ -2970,14 +3486,8 @@ Stadium::udp_recv_from_online_coach()
                 parseOnlineCoachInit( message, cli_addr );
             }
         }
-        else if ( errno != EWOULDBLOCK )
-        {
-            std::cerr << __FILE__ << ": " << __LINE__
-                      << ": Error recv'ing from socket: "
-                      << strerror( errno ) << std::endl;
-        }
 
-        if ( len < 0 )
+        if ( n < static_cast< int >( RECV_BATCH_SIZE ) )
         {
             break;
         }
@@ -3086,7 +3596,7 @@ void
 Stadium::sendToPlayer( const char * msg,
                        const rcss::net::Addr & cli_addr )
 {
-    if ( M_player_socket.send( msg, std::strlen( msg ) + 1, cli_addr ) == -1 )
+    if ( M_player_socket->send( msg, std::strlen( msg ) + 1, cli_addr ) == -1 )
     {
         std::cerr << __FILE__ ": " << __LINE__
                   << ": Error sending to socket: "
@@ -3098,7 +3608,7 @@ void
 Stadium::sendToCoach( const char * msg,
                       const rcss::net::Addr & cli_addr )
 {
-    if ( M_offline_coach_socket.send( msg, std::strlen( msg ) + 1, cli_addr ) == -1 )
+    if ( M_offline_coach_socket->send( msg, std::strlen( msg ) + 1, cli_addr ) == -1 )
     {
         std::cerr << __FILE__ ": " << __LINE__
                   << ": Error sending to socket: "
@@ -3110,7 +3620,7 @@ void
 Stadium::sendToOnlineCoach( const char * msg,
                             const rcss::net::Addr & cli_addr )
 {
-    if ( M_online_coach_socket.send( msg, std::strlen( msg ) + 1, cli_addr ) == -1 )
+    if ( M_online_coach_socket->send( msg, std::strlen( msg ) + 1, cli_addr ) == -1 )
     {
         std::cerr << __FILE__ ": " << __LINE__
                   << ": Error sending to socket: "
@@ -3121,21 +3631,24 @@ Stadium::sendToOnlineCoach( const char * msg,
 void
 Stadium::doQuit()
 {
-    finalize( "Quit Server. Exiting..." );
+    finalize( M_killed
+              ? "Server Killed. Exiting..."
+              : "Quit Server. Exiting..." );
 }
 
 void
 Stadium::finalize( const std::string & msg )
 {
-    static bool s_first = true;
-    if ( s_first )
+    if ( ! M_finalized )
     {
-        s_first = false;
+        M_finalized = true;
         killTeams();
         std::cout << '\n' << msg << '\n';
         Logger::instance().close( *this );
         saveResults();
         disable();
+        M_output_stage.drain();
+        M_io_ring.flush();
     }
 }
 
@@ -24,20 +24,35 @@
 
 #include "timeable.h"
 
+#include "clientpoller.h"
+#include "networkingest.h"
+#include "outputstage.h"
+#include "workerpool.h"
 
 #include "object.h"
 #include "field.h"
+#include "distancetable.h"
+#include "broadcastcache.h"
+#include "initpayloadcache.h"
+#include "broadphase.h"
+#include "kinematicsbatch.h"
+#include "timingwheel.h"
+#include "param.h"
 #include "weather.h"
 #include "resultsaver.hpp"
 
 #include <rcss/gzip/gzfstream.hpp>
 #include <rcss/net/udpsocket.hpp>
+#include <rcss/net/iouring.hpp>
 
+#include <csignal>
 #include <cstdio>
 #include <string>
 #include <vector>
 #include <list>
 #include <memory>
+#include <unordered_map>
+#include <chrono>
 
 class HeteroPlayer;
 class XPMHolder;
@@ -49,6 +64,8 @@ class OnlineCoach;
 class Team;
 
 class Referee;
+class RemoteClient;
+struct pollfd;
 
 namespace rcss {
 class Listener;
@@ -73,6 +90,8 @@ public:
     typedef std::vector< Monitor * > MonitorCont;
     typedef std::vector< rcss::Listener * > ListenerCont;
     typedef std::vector< MPObject * > MPObjectCont;
+    //! connected clients of a shared socket, by source address
+    typedef std::unordered_map< rcss::net::Addr, RemoteClient * > ClientIndex;
 protected:
     // definitions of different timeable methods
     void doRecvFromClients( ) override;
@@ -86,10 +105,13 @@ protected:
 
 protected:
     bool M_alive;
+    //! set by interrupt() from a signal handler
+    volatile std::sig_atomic_t M_killed;
 
-    rcss::net::UDPSocket M_player_socket;
-    rcss::net::UDPSocket M_offline_coach_socket;
-    rcss::net::UDPSocket M_online_coach_socket;
+    // shared sockets, on a UDP port or a Unix domain socket path
+    std::unique_ptr< rcss::net::Socket > M_player_socket;
+    std::unique_ptr< rcss::net::Socket > M_offline_coach_socket;
+    std::unique_ptr< rcss::net::Socket > M_online_coach_socket;
 
     Field M_field;
     Weather M_weather;
@@ -99,13 +121,65 @@ protected:
     OnlineCoachCont M_remote_online_coaches; //!< connected coaches
     MonitorCont M_monitors; //!< connected monitors
 
+    ClientIndex M_player_port_clients; //!< players and monitors on the player port
+    ClientIndex M_offline_coach_port_clients; //!< trainers on the offline coach port
+    ClientIndex M_online_coach_port_clients; //!< coaches on the online coach port
+
+    //! receives the dedicated sockets in the background, if enabled
+    NetworkIngest M_ingest;
+
+    // readiness of the dedicated sockets, one set per client kind
+    ClientPoller M_player_poller;
+    ClientPoller M_offline_coach_poller;
+    ClientPoller M_online_coach_poller;
+    ClientPoller M_monitor_poller;
+
+    //! the descriptors waitForClientMessages() polls, rebuilt when a client is added or removed
+    std::unique_ptr< pollfd[] > M_poll_fds;
+    std::size_t M_poll_fds_size; //!< allocated
+    std::size_t M_poll_fds_count; //!< in use
+    unsigned long M_poll_fds_changes; //!< ClientPoller::changes() of the pollers when built
+
+    //! queued output of the dedicated sockets, flushed once per timer event
+    rcss::net::IOURing M_io_ring;
+    //! sends the queued output on a separate thread, if enabled
+    OutputStage M_output_stage;
+    //! where the clients queue their output
+    rcss::net::SendQueue * M_send_queue;
+    //! queued messages that could not be sent, taken from M_send_queue
+    std::vector< rcss::net::SendFailure > M_send_failures;
+
+    //! helps to build the player visuals, if enabled
+    WorkerPool M_worker_pool;
+    PlayerCont M_visual_targets; //!< players whose visual is being built
+
+    //! next visuals of the players, by index in M_players, in visual ticks
+    TimingWheel M_visual_wheel;
+    //! next visuals of the synch_see players, in synch visual ticks
+    TimingWheel M_synch_visual_wheel;
+    //! tick of the last visual of each player on its wheel
+    std::vector< TimingWheel::Tick > M_last_visual;
+    std::vector< std::size_t > M_due_visuals; //!< ids taken off a wheel
+
     ListenerCont M_listeners;
+    //! the audio being sent to M_listeners, so that they serialize each
+    //! variant of the message once
+    BroadcastCache M_broadcast_cache;
 
     MPObjectCont M_movable_objects;
+    KinematicsBatch M_kinematics; //!< accelerates M_movable_objects
 
     Ball * M_ball;
     PlayerCont M_players; //!< player instance container
     PlayerCont M_shuffle_players; //!< reference player container
+    //! MAX_PLAYER slots per team for the binary formats, 0 when empty
+    std::vector< const Player * > M_binary_format_players;
+    DistanceTable M_distances; //!< between the ball and M_players
+
+    //! M_players, then the ball
+    std::vector< const MPObject * > M_collision_objects;
+    Broadphase M_broadphase;
+    std::vector< Broadphase::Pair > M_contacts; //!< candidates of the current collision check
     Coach * M_coach;
     OnlineCoachCont M_olcoaches;
     Team * M_team_l;
@@ -117,6 +191,8 @@ protected:
     int M_stoppage_time;
 
     std::vector< HeteroPlayer * > M_player_types;
+    //! the parameter messages of the init protocol
+    InitPayloadCache M_init_payload_cache;
 
 
     const Player * M_ball_catcher; /* goalie who has caught ball */
@@ -138,6 +214,21 @@ protected:
 
     std::list< ResultSaver::Ptr > M_savers;
 
+    // per-match bookkeeping that used to live in function-local statics
+    int M_long_kick_time; //!< last cycle the delayed long kicks were applied
+    int M_long_kick_stoppage_time;
+    std::chrono::system_clock::time_point M_prev_step_time;
+    int M_cycles_missed; //!< number of synch cycles where someone missed
+    int M_monitor_wait_count;
+    bool M_finalized;
+
+    //! number of datagrams read from a shared socket by one system call
+    static const std::size_t RECV_BATCH_SIZE = 32;
+    //! receive buffers for the shared sockets, MaxMesg + 1 bytes per datagram
+    std::vector< char > M_recv_buffer;
+    int M_recv_sizes[ RECV_BATCH_SIZE ];
+    rcss::net::Addr M_recv_addrs[ RECV_BATCH_SIZE ];
+
 public:
 
     Stadium();
@@ -149,10 +240,20 @@ public:
 
     void finalize( const std::string & msg );
 
+    /*!
+      \brief make the timer loop end, so that the match is finalized on
+      the main thread.  the only member function that is safe to call
+      from a signal handler.
+     */
+    void interrupt()
+      {
+          M_killed = 1;
+      }
+
     virtual
     bool isAlive() override
       {
-          return M_alive;
+          return M_alive && ! M_killed;
       }
 
     PlayMode playmode() const
@@ -187,12 +288,43 @@ public:
           return M_field;
       }
 
+    //! the id of a new movable object, unique in this match
+    int newObjectId()
+      {
+          return M_field.newObjectId();
+      }
+
     const
     Ball & ball() const
       {
           return *M_ball;
       }
 
+    const
+    DistanceTable & distances() const
+      {
+          return M_distances;
+      }
+
+    BroadcastCache & broadcastCache()
+      {
+          return M_broadcast_cache;
+      }
+
+    InitPayloadCache & initPayloadCache()
+      {
+          return M_init_payload_cache;
+      }
+
+    /*!
+      \brief update the time of the next visual of a player
+      \param player the player
+      \param restart true if the player has just connected, false if
+      its visual send interval or synch_see mode has changed
+     */
+    void scheduleVisual( const Player & player,
+                         const bool restart );
+
     const
     Team & teamLeft() const
       {
@@ -230,6 +362,18 @@ public:
           return M_players;
       }
 
+    /*!
+      \brief the players as laid out in the binary monitor and log formats
+      \return MAX_PLAYER slots for each team.  The players beyond the
+      MAX_PLAYER-th of a team are left out, and the slots beyond the
+      team size are 0.
+     */
+    const
+    std::vector< const Player * > & binaryFormatPlayers() const
+      {
+          return M_binary_format_players;
+      }
+
     MonitorCont & monitors()
       {
           return M_monitors;
@@ -286,8 +430,22 @@ private:
     void udp_recv_from_coach();
     void udp_recv_from_online_coach();
 
+    //! drain up to RECV_BATCH_SIZE datagrams of socket into the receive buffers
+    int recvDatagrams( rcss::net::Socket & socket );
+    char * datagram( const int i )
+      {
+          return M_recv_buffer.data() + i * ( MaxMesg + 1 );
+      }
+
+    //! block until a client socket is readable or timeout_msec elapses
+    void waitForClientMessages( const int timeout_msec );
+    //! collect the descriptors of the shared sockets and the clients into M_poll_fds
+    void buildPollFDs();
+
     void parsePlayerInit( const char * message,
                           const rcss::net::Addr & cli_addr );
+    //! move a newly connected player, which asked for it, to shared memory
+    void openSharedMemory( Player * player );
     bool parseMonitorInit( const char * message,
                            const rcss::net::Addr & cli_addr );
     bool parseCoachInit( const char * message,
@@ -308,6 +466,27 @@ private:
                                    const double & version,
                                    const rcss::net::Addr & addr );
 
+    static
+    void indexClient( ClientIndex & index,
+                      const rcss::net::Addr & addr,
+                      RemoteClient * client );
+    static
+    void unindexClient( ClientIndex & index,
+                        const RemoteClient * client );
+    static
+    RemoteClient * findClient( ClientIndex & index,
+                               const rcss::net::Addr & addr );
+
+    //! send or hand over the client messages of the current timer event
+    void flushOutput();
+
+    //! close the clients whose queued messages could not be sent
+    void closeFailedClients();
+
+    //! call send on the players due on the wheel, on the worker pool if there is one
+    void sendPlayerVisuals( TimingWheel & wheel,
+                            void ( Player::*send )() );
+
     void removeDisconnectedClients();
 
     void step();
@@ -26,12 +26,67 @@
 #include "stdtimer.h"
 
 #include "timeable.h"
-#include "param.h"          // needed for TIMEDELTA
 #include "serverparam.h"    // needed for ServerParam
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+/*!
+  \class Deadline
+  \brief absolute, drift free schedule of a periodic event.
+
+  The next due time is always the previous due time plus the period, so
+  the time spent handling an event never shifts the following ones.
+  If the timer falls behind by whole periods, the missed activations are
+  dropped instead of being run back to back.
+ */
+class Deadline {
+private:
+    Clock::time_point M_next;
+    Clock::duration M_period;
+
+public:
+    Deadline( const Clock::time_point & first,
+              const Clock::duration & period )
+        : M_next( first ),
+          M_period( period )
+      { }
+
+    const Clock::time_point & next() const
+      {
+          return M_next;
+      }
+
+    bool isDue( const Clock::time_point & now ) const
+      {
+          return M_next <= now;
+      }
+
+    //! move to the first activation after now, keeping the phase
+    void advance( const Clock::time_point & now )
+      {
+          M_next += M_period;
+          if ( M_next <= now )
+          {
+              M_next += M_period * ( ( now - M_next ) / M_period + 1 );
+          }
+      }
+
+    //! delay the schedule, keeping the period
+    void shift( const Clock::duration & delay )
+      {
+          M_next += delay;
+      }
+};
+
+}
+
+
 StandardTimer::StandardTimer( Timeable & timeable )
     : Timer( timeable )
 {
@@ -40,130 +95,115 @@ StandardTimer::StandardTimer( Timeable & timeable )
 
 
 /** This method controls the standard timer.
-    In the mainloop, the sleep is called for each trial.
-    The sleep time is determined by subtracting the consumued time from the default delta.
-    After finishing the sleep, checking which messages should be sent / received by the clients and handles them appropriately. */
+    Each periodic event (message reception, simulation step, sense body,
+    visual tick, synch see and coach visual) keeps its own absolute
+    deadline on the monotonic clock.  The main loop sleeps until the
+    earliest deadline, and then handles every event that is due in the
+    fixed order: receive, simulate, sense body, visuals, synch visuals,
+    coach visuals.  Since deadlines are absolute, the cycle length does
+    not drift with the time consumed by the handlers. */
 void
 StandardTimer::run()
 {
-    double lcmt = 0.0;
-
-    // the sequence of messages will always repeat itself after lcm_st ms.
-    // the number of messages that should be processed before the sequence
-    // "quits" thus equals (lcm_st / x) where x is the time interval for the
-    // specific message
-    // Example: lcm_st = 300, sim_st = 100, q_simt = 300 / 100 = 3.
-    //          three simulations steps have to occur in one sequence
-    // in the default case the listed variables will have the following values
-    // q_simt = 3  (simulation step)
-    // q_sent = 8  (sending visual information - low quality, narrow width)
-    // q_rect = 30 (process arrival of messages)
-    // q_sbt  = 3  (sense body step)
-    // q_svt  = 3  (coach look interval)
-    // c_* will contain the number of processed messages in this sequence
-    int c_simt = 1, c_sent = 1, c_rect = 1, c_sbt = 1, c_svt = 1,
-        q_simt = ServerParam::instance().lcmStep() / ServerParam::instance().simStep(),
-        q_sent = ServerParam::instance().lcmStep() / ServerParam::instance().sendStep()*4,
-        q_rect = ServerParam::instance().lcmStep() / ServerParam::instance().recvStep(),
-        q_sbt = ServerParam::instance().lcmStep() / ServerParam::instance().senseBodyStep(),
-        q_svt = ServerParam::instance().lcmStep() / ServerParam::instance().coachVisualStep();
-    int c_synch_see = 1;
+    const ServerParam & param = ServerParam::instance();
+
+    const Clock::duration sim_step = std::chrono::milliseconds( param.simStep() );
+    const Clock::duration recv_step = std::chrono::milliseconds( param.recvStep() );
+    const Clock::duration sense_body_step = std::chrono::milliseconds( param.senseBodyStep() );
+    const Clock::duration coach_visual_step = std::chrono::milliseconds( param.coachVisualStep() );
+    // visual messages are checked four times per send_step,
+    // which is not always a whole number of milliseconds.
+    const Clock::duration visual_step = std::chrono::microseconds( param.sendStep() * 250 );
+    const Clock::duration synch_see_offset = std::chrono::milliseconds( param.synchSeeOffset() );
+
+    const Clock::time_point start_time = Clock::now();
+
+    Deadline recv( start_time + recv_step, recv_step );
+    Deadline sim( start_time + sim_step, sim_step );
+    Deadline sense_body( start_time + sense_body_step, sense_body_step );
+    Deadline visual( start_time + visual_step, visual_step );
+    Deadline coach_visual( start_time + coach_visual_step, coach_visual_step );
+
+    // synch see is sent once per simulation step,
+    // synch_see_offset after the start of the step.
+    Clock::time_point synch_see = start_time + synch_see_offset;
     bool sent_synch_see = false;
 
-    const std::chrono::milliseconds default_delta( TIMEDELTA );
-    std::chrono::nanoseconds elapsed( 0 );
-    std::chrono::system_clock::time_point start_time = std::chrono::system_clock::now();
-
     while ( getTimeableRef().alive() )
     {
-        const std::chrono::nanoseconds elapsed = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::system_clock::now() - start_time );
-        const std::chrono::nanoseconds sleep_count = default_delta - elapsed;
-        std::this_thread::sleep_for( sleep_count );
+        Clock::time_point wakeup = std::min( { recv.next(),
+                                               sim.next(),
+                                               sense_body.next(),
+                                               visual.next(),
+                                               coach_visual.next() } );
+        if ( ! sent_synch_see )
+        {
+            wakeup = std::min( wakeup, synch_see );
+        }
+
+        std::this_thread::sleep_until( wakeup );
 
-        start_time = std::chrono::system_clock::now();
-        lcmt += ( sleep_count.count() < 0
-                  ? elapsed.count() * 0.001 * 0.001
-                  : ( sleep_count.count() + elapsed.count() ) * 0.001 * 0.001 );
+        const Clock::time_point now = Clock::now();
 
-        if ( lcmt >= ServerParam::instance().simStep() * c_simt )
+        if ( now - sim.next() >= sim_step )
         {
-            c_simt = static_cast< int >( std::floor( lcmt / ServerParam::instance().simStep() ) );
-            lcmt = ServerParam::instance().simStep() * c_simt;
-            // the above lines are needed to
-            // prevent short "catch up" cycles if
-            // the current cycle was slow
+            // we missed at least one whole cycle.  start the next cycle
+            // from now to prevent short "catch up" cycles, and delay the
+            // other events by as much, so that they keep their phase
+            // relative to the simulation step.  this is done before any
+            // event is handled, so that no deadline that was already
+            // advanced in this wakeup is delayed again.
+            const Clock::duration delay = now - sim.next();
+            recv.shift( delay );
+            sim.shift( delay );
+            sense_body.shift( delay );
+            visual.shift( delay );
+            coach_visual.shift( delay );
         }
 
         // receive messages
-        if ( lcmt >= ServerParam::instance().recvStep() * c_rect )
+        if ( recv.isDue( now ) )
         {
             getTimeableRef().recvFromClients();
-            c_rect = static_cast< int >( std::floor( lcmt / ServerParam::instance().recvStep() ) );
-            if ( q_rect <= c_rect )
-                c_rect = 1;
-            else
-                c_rect++;
+            recv.advance( now );
         }
 
         // update after new simulation step
-        if ( lcmt >= ServerParam::instance().simStep() * c_simt )
+        if ( sim.isDue( now ) )
         {
             getTimeableRef().newSimulatorStep();
-            if ( q_simt <= c_simt )
-                c_simt = 1;
-            else
-                c_simt++;
+            synch_see = sim.next() + synch_see_offset;
+            sim.advance( now );
             sent_synch_see = false;
         }
 
         // send sense body
-        if ( lcmt >= ServerParam::instance().senseBodyStep() * c_sbt )
+        if ( sense_body.isDue( now ) )
         {
             getTimeableRef().sendSenseBody();
-            c_sbt = static_cast< int >( std::floor( lcmt / ServerParam::instance().senseBodyStep() ) );
-            if ( q_sbt <= c_sbt )
-                c_sbt = 1;
-            else
-                c_sbt++;
+            sense_body.advance( now );
         }
 
         // send visual messages
-        if ( lcmt >= ( ServerParam::instance().sendStep() * 0.25 ) * c_sent )
+        if ( visual.isDue( now ) )
         {
             getTimeableRef().sendVisuals();
-            c_sent = static_cast< int >( std::floor( lcmt/(ServerParam::instance().sendStep() * 0.25 ) ) );
-            if ( q_sent <= c_sent )
-                c_sent = 1;
-            else
-                c_sent++;
+            visual.advance( now );
         }
 
         // send synch visual message
         if ( ! sent_synch_see
-             && lcmt >= ( ServerParam::instance().simStep() * ( c_synch_see - 1 )
-                          + ServerParam::instance().synchSeeOffset() ) )
+             && synch_see <= now )
         {
-            //std::cerr << "lcmt=" << lcmt << "  c_synch_see=" << c_synch_see << '\n';
             getTimeableRef().sendSynchVisuals();
-            ++c_synch_see;
             sent_synch_see = true;
         }
 
         // send coach look messages
-        if ( lcmt >= ServerParam::instance().coachVisualStep() * c_svt )
+        if ( coach_visual.isDue( now ) )
         {
             getTimeableRef().sendCoachMessages();
-            c_svt = static_cast< int >( std::floor( lcmt / ServerParam::instance().coachVisualStep() ) );
-            if ( q_svt <= c_svt )
-                c_svt = 1;
-            else
-                c_svt++;
-        }
-
-        if ( lcmt >= ServerParam::instance().lcmStep() )
-        {
-            lcmt = 0;
-            c_synch_see = 1;
+            coach_visual.advance( now );
         }
     }
 
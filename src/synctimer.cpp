@@ -26,18 +26,26 @@
 #include "synctimer.h"
 
 #include "timeable.h"
+#include "param.h"          // needed for TIMEDELTA
 #include "serverparam.h"    // needed for ServerParam
 
-void
-SyncTimer::run()
+#include <cmath>
+
+SyncTimer::EventList
+SyncTimer::createEventList( const Steps & steps,
+                            bool & sent_synch_see )
 {
     // for explanation different counters, see StandardTimer::run
-    // big difference is that the loop is not started when a new signal comes,
-    // but rather immediately when the previous loop has ended. Each loop
-    // represents synch_offset msec (default 60 msec). So after the loop has been
-    // traversed 6 times and the appropriate message are sent, the think command
-    // is sent and the program waits for all the client instructions and the final
-    // "done". When a done message is received for each client, the loop continues
+    // the sequence of events always repeats itself after lcm_step msec.,
+    // so the counters are run for one lcm_step here and the resulting
+    // event sequence is replayed by run() afterwards.
+    // Each loop represents TIMEDELTA msec. Only the loops where at least
+    // one event occurs are recorded.
+    // All the counters but sent_synch_see start from the same values in
+    // every lcm_step.  sent_synch_see belongs to the simulator step that
+    // spans the boundary, so it is carried over by the caller.
+
+    EventList event_list;
 
     double lcmt= 0;
     int c_simt = 1,
@@ -46,20 +54,21 @@ SyncTimer::run()
         c_svt  = 1,
         c_synch= 1,
         c_synch_see = 1,
-        q_simt = ServerParam::instance().lcmStep()/ServerParam::instance().simStep(),
-        q_sent = ServerParam::instance().lcmStep()/ServerParam::instance().sendStep()*4,
-        q_sbt  = ServerParam::instance().lcmStep()/ServerParam::instance().senseBodyStep(),
-        q_svt  = ServerParam::instance().lcmStep()/ServerParam::instance().coachVisualStep();
-    bool sent_synch_see = false;
+        q_simt = steps.lcm_step_/steps.sim_step_,
+        q_sent = steps.lcm_step_/steps.send_step_*4,
+        q_sbt  = steps.lcm_step_/steps.sense_body_step_,
+        q_svt  = steps.lcm_step_/steps.coach_visual_step_;
 
-    while ( getTimeableRef().alive() )
+    while ( lcmt < steps.lcm_step_ )
     {
         lcmt += TIMEDELTA;
 
+        Tick tick;
+
         // new simulation step
-        if ( lcmt >= ServerParam::instance().simStep() * c_simt )
+        if ( lcmt >= steps.sim_step_ * c_simt )
         {
-            getTimeableRef().newSimulatorStep();
+            tick.push_back( NEW_SIMULATOR_STEP );
             if ( q_simt <= c_simt )
             {
                 c_simt = 1;
@@ -72,10 +81,10 @@ SyncTimer::run()
         }
 
         // new sense body step
-        if ( lcmt >= ServerParam::instance().senseBodyStep() * c_sbt )
+        if ( lcmt >= steps.sense_body_step_ * c_sbt )
         {
-            getTimeableRef().sendSenseBody();
-            c_sbt = static_cast< int >( std::floor( lcmt / ServerParam::instance().senseBodyStep() ) );
+            tick.push_back( SEND_SENSE_BODY );
+            c_sbt = static_cast< int >( std::floor( lcmt / steps.sense_body_step_ ) );
             if ( q_sbt <= c_sbt )
             {
                 c_sbt = 1;
@@ -87,10 +96,10 @@ SyncTimer::run()
         }
 
         // send visuals
-        if ( lcmt >= (ServerParam::instance().sendStep() * 0.25 ) * c_sent )
+        if ( lcmt >= ( steps.send_step_ * 0.25 ) * c_sent )
         {
-            getTimeableRef().sendVisuals();
-            c_sent = static_cast< int >( std::floor( lcmt / (ServerParam::instance().sendStep() * 0.25 ) ) );
+            tick.push_back( SEND_VISUALS );
+            c_sent = static_cast< int >( std::floor( lcmt / ( steps.send_step_ * 0.25 ) ) );
             if ( q_sent <= c_sent )
             {
                 c_sent = 1;
@@ -103,19 +112,19 @@ SyncTimer::run()
 
         // send synch visual message
         if ( ! sent_synch_see
-             && lcmt >= ( ServerParam::instance().simStep() * ( c_synch_see - 1 )
-                          + ServerParam::instance().synchSeeOffset() ) )
+             && lcmt >= ( steps.sim_step_ * ( c_synch_see - 1 )
+                          + steps.synch_see_offset_ ) )
         {
-            getTimeableRef().sendSynchVisuals();
+            tick.push_back( SEND_SYNCH_VISUALS );
             ++c_synch_see;
             sent_synch_see = true;
         }
 
         // send coach messages
-        if ( lcmt >= ServerParam::instance().coachVisualStep() * c_svt )
+        if ( lcmt >= steps.coach_visual_step_ * c_svt )
         {
-            getTimeableRef().sendCoachMessages();
-            c_svt = static_cast< int >( std::floor( lcmt / ServerParam::instance().coachVisualStep() ) );
+            tick.push_back( SEND_COACH_MESSAGES );
+            c_svt = static_cast< int >( std::floor( lcmt / steps.coach_visual_step_ ) );
             if ( q_svt <= c_svt )
             {
                 c_svt = 1;
@@ -127,19 +136,101 @@ SyncTimer::run()
         }
 
         //we do a c_synch-1 because of the offset
-        if ( lcmt >= ServerParam::instance().simStep() * ( c_synch - 1 ) + ServerParam::instance().synchOffset() )
+        if ( lcmt >= steps.sim_step_ * ( c_synch - 1 ) + steps.synch_offset_ )
         {
-            getTimeableRef().sendThink();
-            /* because of the strange offset nature here,
-               we let the lcmt advancement below handle the resetting to 1 */
+            tick.push_back( SEND_THINK );
             c_synch++;
         }
 
-        if ( lcmt >= ServerParam::instance().lcmStep() )
+        if ( ! tick.empty() )
+        {
+            event_list.push_back( tick );
+        }
+    }
+
+    return event_list;
+}
+
+void
+SyncTimer::dispatch( const Tick & tick )
+{
+    for ( const Event ev : tick )
+    {
+        switch ( ev ) {
+        case NEW_SIMULATOR_STEP:
+            getTimeableRef().newSimulatorStep();
+            break;
+        case SEND_SENSE_BODY:
+            getTimeableRef().sendSenseBody();
+            break;
+        case SEND_VISUALS:
+            getTimeableRef().sendVisuals();
+            break;
+        case SEND_SYNCH_VISUALS:
+            getTimeableRef().sendSynchVisuals();
+            break;
+        case SEND_COACH_MESSAGES:
+            getTimeableRef().sendCoachMessages();
+            break;
+        case SEND_THINK:
+            getTimeableRef().sendThink();
+            break;
+        }
+    }
+}
+
+void
+SyncTimer::run()
+{
+    // big difference with StandardTimer is that the loop is not started when
+    // a new signal comes, but rather immediately when the previous loop has
+    // ended.  After the appropriate messages are sent, the think command
+    // is sent and the program waits for all the client instructions and the
+    // final "done".  When a done message is received for each client, the
+    // loop continues.
+    // The event sequence of one lcm_step is computed once and then dispatched
+    // directly, so no time is spent on loops where nothing happens.
+    // The first lcm_step starts without a synch see sent.  Every later one
+    // starts with the state the previous one ended with, which is the same
+    // each time, so the second sequence is the one that repeats.
+
+    const ServerParam & param = ServerParam::instance();
+    const Steps steps = { param.simStep(),
+                          param.sendStep(),
+                          param.senseBodyStep(),
+                          param.coachVisualStep(),
+                          param.synchOffset(),
+                          param.synchSeeOffset(),
+                          param.lcmStep() };
+
+    bool sent_synch_see = false;
+    const EventList first_list = createEventList( steps, sent_synch_see );
+    const EventList event_list = createEventList( steps, sent_synch_see );
+
+    if ( event_list.empty() )
+    {
+        getTimeableRef().quit();
+        return;
+    }
+
+    for ( const Tick & tick : first_list )
+    {
+        if ( ! getTimeableRef().alive() )
+        {
+            break;
+        }
+        dispatch( tick );
+    }
+
+    EventList::const_iterator tick = event_list.begin();
+
+    while ( getTimeableRef().alive() )
+    {
+        dispatch( *tick );
+
+        if ( ++tick == event_list.end() )
         {
-            lcmt = 0;
-            c_synch = 1;
-            c_synch_see = 1;
+            tick = event_list.begin();
         }
     }
 
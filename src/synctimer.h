@@ -24,6 +24,8 @@
 
 #include "timer.h"
 
+#include <vector>
+
 /** This is a subclass of the timer class. The run method specifes the
     synchronization timer. This timer waits till all messages are received by
     the client before continuing. */
@@ -38,6 +40,49 @@ public:
 
     void run() override;
 
+    enum Event {
+        NEW_SIMULATOR_STEP,
+        SEND_SENSE_BODY,
+        SEND_VISUALS,
+        SEND_SYNCH_VISUALS,
+        SEND_COACH_MESSAGES,
+        SEND_THINK,
+    };
+
+    //! events that occur in the same TIMEDELTA slot, in dispatch order
+    typedef std::vector< Event > Tick;
+    typedef std::vector< Tick > EventList;
+
+    /*!
+      \struct Steps
+      \brief the intervals [msec] the event sequence depends on.
+     */
+    struct Steps {
+        int sim_step_;
+        int send_step_;
+        int sense_body_step_;
+        int coach_visual_step_;
+        int synch_offset_;
+        int synch_see_offset_;
+        int lcm_step_;
+    };
+
+    /*!
+      \brief build the ordered event sequence of one lcm_step
+      \param steps the intervals of the events
+      \param sent_synch_see whether the synch see of the current simulator
+      step was already sent.  It is updated to the value at the end of the
+      sequence, which is where the next lcm_step starts.
+      \return the ticks with at least one event
+     */
+    static
+    EventList createEventList( const Steps & steps,
+                               bool & sent_synch_see );
+
+private:
+
+    void dispatch( const Tick & tick );
+
 //     static
 //     void
 //     destroy( SyncTimer* c );
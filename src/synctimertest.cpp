@@ -0,0 +1,260 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              synctimertest.cpp
+                  Event sequence test of the synchronous timer
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+/*
+ * Compares the events SyncTimer::run() dispatches, the first event list
+ * followed by the repeated second one, with the events of the former
+ * loop that ran the counters for every TIMEDELTA slot, over several
+ * lcm_steps and for several step settings.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "synctimer.h"
+#include "param.h"
+
+#include <algorithm>
+#include <iostream>
+#include <cmath>
+
+namespace {
+
+const int LCM_PERIODS = 6;
+
+int
+gcd( int a,
+     int b )
+{
+    while ( b != 0 )
+    {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+int
+lcm( const int a,
+     const int b )
+{
+    return a / gcd( a, b ) * b;
+}
+
+SyncTimer::Steps
+makeSteps( const int sim_step,
+           const int send_step,
+           const int sense_body_step,
+           const int coach_visual_step,
+           const int synch_offset,
+           const int synch_see_offset )
+{
+    // the same as ServerParam::setSlowDownFactor() in synch_mode, with
+    // the default recv_step
+    const int recv_step = 10;
+    const SyncTimer::Steps steps = {
+        sim_step,
+        send_step,
+        sense_body_step,
+        coach_visual_step,
+        synch_offset,
+        synch_see_offset,
+        lcm( sim_step,
+             lcm( send_step,
+                  lcm( recv_step,
+                       lcm( sense_body_step,
+                            lcm( coach_visual_step,
+                                 lcm( std::max( synch_see_offset, 1 ),
+                                      synch_offset ) ) ) ) ) )
+    };
+    return steps;
+}
+
+
+/*!
+  the events of the former SyncTimer::run(), which ran the counters
+  without end and reset the lcm_step ones at the end of every lcm_step.
+ */
+SyncTimer::EventList
+baselineEvents( const SyncTimer::Steps & steps,
+                const int periods )
+{
+    SyncTimer::EventList event_list;
+
+    double lcmt= 0;
+    int c_simt = 1,
+        c_sent = 1,
+        c_sbt  = 1,
+        c_svt  = 1,
+        c_synch= 1,
+        c_synch_see = 1,
+        q_simt = steps.lcm_step_/steps.sim_step_,
+        q_sent = steps.lcm_step_/steps.send_step_*4,
+        q_sbt  = steps.lcm_step_/steps.sense_body_step_,
+        q_svt  = steps.lcm_step_/steps.coach_visual_step_;
+    bool sent_synch_see = false;
+
+    int period = 0;
+    while ( period < periods )
+    {
+        lcmt += TIMEDELTA;
+
+        SyncTimer::Tick tick;
+
+        if ( lcmt >= steps.sim_step_ * c_simt )
+        {
+            tick.push_back( SyncTimer::NEW_SIMULATOR_STEP );
+            if ( q_simt <= c_simt ) c_simt = 1; else c_simt++;
+            sent_synch_see = false;
+        }
+
+        if ( lcmt >= steps.sense_body_step_ * c_sbt )
+        {
+            tick.push_back( SyncTimer::SEND_SENSE_BODY );
+            c_sbt = static_cast< int >( std::floor( lcmt / steps.sense_body_step_ ) );
+            if ( q_sbt <= c_sbt ) c_sbt = 1; else c_sbt++;
+        }
+
+        if ( lcmt >= ( steps.send_step_ * 0.25 ) * c_sent )
+        {
+            tick.push_back( SyncTimer::SEND_VISUALS );
+            c_sent = static_cast< int >( std::floor( lcmt / ( steps.send_step_ * 0.25 ) ) );
+            if ( q_sent <= c_sent ) c_sent = 1; else c_sent++;
+        }
+
+        if ( ! sent_synch_see
+             && lcmt >= ( steps.sim_step_ * ( c_synch_see - 1 )
+                          + steps.synch_see_offset_ ) )
+        {
+            tick.push_back( SyncTimer::SEND_SYNCH_VISUALS );
+            ++c_synch_see;
+            sent_synch_see = true;
+        }
+
+        if ( lcmt >= steps.coach_visual_step_ * c_svt )
+        {
+            tick.push_back( SyncTimer::SEND_COACH_MESSAGES );
+            c_svt = static_cast< int >( std::floor( lcmt / steps.coach_visual_step_ ) );
+            if ( q_svt <= c_svt ) c_svt = 1; else c_svt++;
+        }
+
+        if ( lcmt >= steps.sim_step_ * ( c_synch - 1 ) + steps.synch_offset_ )
+        {
+            tick.push_back( SyncTimer::SEND_THINK );
+            c_synch++;
+        }
+
+        if ( ! tick.empty() )
+        {
+            event_list.push_back( tick );
+        }
+
+        if ( lcmt >= steps.lcm_step_ )
+        {
+            lcmt = 0;
+            c_synch = 1;
+            c_synch_see = 1;
+            ++period;
+        }
+    }
+
+    return event_list;
+}
+
+
+//! the events SyncTimer::run() dispatches
+SyncTimer::EventList
+timerEvents( const SyncTimer::Steps & steps,
+             const int periods )
+{
+    bool sent_synch_see = false;
+    const SyncTimer::EventList first_list = SyncTimer::createEventList( steps, sent_synch_see );
+    const SyncTimer::EventList repeated_list = SyncTimer::createEventList( steps, sent_synch_see );
+
+    SyncTimer::EventList event_list = first_list;
+    for ( int i = 1; i < periods; ++i )
+    {
+        event_list.insert( event_list.end(), repeated_list.begin(), repeated_list.end() );
+    }
+
+    return event_list;
+}
+
+
+int
+check( const SyncTimer::Steps & steps )
+{
+    const SyncTimer::EventList expected = baselineEvents( steps, LCM_PERIODS );
+    const SyncTimer::EventList result = timerEvents( steps, LCM_PERIODS );
+
+    if ( result == expected )
+    {
+        return 0;
+    }
+
+    const std::size_t n = std::min( result.size(), expected.size() );
+    std::size_t i = 0;
+    while ( i < n && result[i] == expected[i] )
+    {
+        ++i;
+    }
+
+    std::cerr << "sim_step " << steps.sim_step_
+              << " send_step " << steps.send_step_
+              << " sense_body_step " << steps.sense_body_step_
+              << " coach_visual_step " << steps.coach_visual_step_
+              << " synch_offset " << steps.synch_offset_
+              << " synch_see_offset " << steps.synch_see_offset_
+              << " lcm_step " << steps.lcm_step_
+              << ": " << result.size() << " ticks instead of " << expected.size()
+              << ", first difference at tick " << i << std::endl;
+    return 1;
+}
+
+}
+
+int
+main()
+{
+    int errors = 0;
+
+    // the defaults
+    errors += check( makeSteps( 100, 150, 100, 100, 60, 0 ) );
+
+    // the synch see in the middle of the step or with the think message
+    errors += check( makeSteps( 100, 150, 100, 100, 60, 30 ) );
+    errors += check( makeSteps( 100, 150, 100, 100, 60, 60 ) );
+    errors += check( makeSteps( 100, 150, 100, 100, 60, 90 ) );
+
+    // a slower sense body, a faster coach and a lcm_step set by the offsets
+    errors += check( makeSteps( 100, 150, 200, 50, 70, 20 ) );
+    errors += check( makeSteps( 50, 75, 50, 100, 30, 10 ) );
+
+    if ( errors > 0 )
+    {
+        return 1;
+    }
+
+    std::cout << "success\n";
+    return 0;
+}
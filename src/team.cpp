@@ -78,10 +78,7 @@ Team::Team( Stadium * stad, const Side s )
         }
     }
 
-    for ( int i = 0; i < MAX_PLAYER; ++i )
-    {
-        M_players[i] = static_cast< Player * >( 0 );
-    }
+    M_players.assign( ServerParam::instance().teamSize(), static_cast< Player * >( 0 ) );
 }
 
 Team::~Team()
@@ -93,7 +90,7 @@ Player *
 Team::newPlayer( const double & version,
                  const bool goalie_flag )
 {
-    if ( size() >= MAX_PLAYER )
+    if ( size() >= static_cast< int >( M_players.size() ) )
     {
         if ( ServerParam::instance().verboseMode() )
         {
@@ -135,7 +132,7 @@ Team::newPlayer( const double & version,
 void
 Team::assignPlayer( int n, Player * player )
 {
-    if ( n < 0 || MAX_PLAYER <= n )
+    if ( n < 0 || static_cast< int >( M_players.size() ) <= n )
     {
         std::cerr << "Error: Too many players are assigned." << std::endl;
         return;
@@ -26,6 +26,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <memory>
 
 class Stadium;
@@ -44,7 +45,7 @@ private:
     std::string M_name;
     const Side M_side;
 
-    Player * M_players[MAX_PLAYER];
+    std::vector< Player * > M_players; //!< ServerParam::teamSize() slots
     int M_size; //! the number of connected players
 
     int M_point;
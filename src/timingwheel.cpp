@@ -0,0 +1,90 @@
+// -*-c++-*-
+
+/***************************************************************************
+                               timingwheel.cpp
+                   Schedule of recurring events by tick count
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "timingwheel.h"
+
+#include <algorithm>
+
+const TimingWheel::Tick TimingWheel::NONE = -1;
+
+TimingWheel::TimingWheel( const std::size_t ids,
+                          const std::size_t slots )
+    : M_due( ids, NONE ),
+      M_now( 0 )
+{
+    std::size_t size = 1;
+    while ( size < slots )
+    {
+        size *= 2;
+    }
+    M_slots.resize( size );
+}
+
+void
+TimingWheel::schedule( const std::size_t id,
+                       Tick due )
+{
+    due = std::max( due, M_now + 1 );
+    if ( M_due[id] == due )
+    {
+        return;
+    }
+
+    M_due[id] = due;
+    Entry entry = { id, due };
+    M_slots[due & ( M_slots.size() - 1 )].push_back( entry );
+}
+
+void
+TimingWheel::advance( std::vector< std::size_t > & ids )
+{
+    ids.clear();
+
+    ++M_now;
+    std::vector< Entry > & slot = M_slots[M_now & ( M_slots.size() - 1 )];
+
+    std::size_t kept = 0;
+    for ( std::size_t i = 0; i < slot.size(); ++i )
+    {
+        const Entry & entry = slot[i];
+        if ( M_due[entry.id_] != entry.due_ )
+        {
+            // cancelled or scheduled again
+            continue;
+        }
+
+        if ( entry.due_ == M_now )
+        {
+            M_due[entry.id_] = NONE;
+            ids.push_back( entry.id_ );
+        }
+        else
+        {
+            // a later turn of the wheel
+            slot[kept++] = entry;
+        }
+    }
+    slot.resize( kept );
+}
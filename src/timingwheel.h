@@ -0,0 +1,102 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                timingwheel.h
+                   Schedule of recurring events by tick count
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_TIMINGWHEEL_H
+#define RCSSSERVER_TIMINGWHEEL_H
+
+#include <vector>
+#include <cstddef>
+
+/*!
+  \class TimingWheel
+  \brief the due ticks of a fixed set of ids, bucketed by tick.
+
+  Each id has at most one due tick.  The wheel has a power of two
+  number of slots, and an id is kept in the slot of its due tick
+  modulo that number, so advancing by one tick only looks at the ids
+  in one slot.  Ids due a whole turn of the wheel or more ahead stay in
+  their slot until their turn comes.  When an id is scheduled again
+  its old entry is left behind and skipped when its slot comes up.
+ */
+class TimingWheel {
+public:
+    typedef long Tick;
+
+    //! the due tick of an id that is not scheduled
+    static const Tick NONE;
+
+private:
+    struct Entry {
+        std::size_t id_;
+        Tick due_;
+    };
+
+    std::vector< std::vector< Entry > > M_slots;
+    std::vector< Tick > M_due; //!< due tick of each id, or NONE
+    Tick M_now; //!< the last tick advanced to
+
+public:
+
+    /*!
+      \param ids the number of ids
+      \param slots the minimum number of slots, best above the longest
+      interval used
+     */
+    TimingWheel( const std::size_t ids,
+                 const std::size_t slots );
+
+    Tick now() const
+      {
+          return M_now;
+      }
+
+    Tick due( const std::size_t id ) const
+      {
+          return M_due[id];
+      }
+
+    bool scheduled( const std::size_t id ) const
+      {
+          return M_due[id] != NONE;
+      }
+
+    /*!
+      \brief set the due tick of an id, replacing the previous one
+      \param id the id
+      \param due the due tick, at least the next tick
+     */
+    void schedule( const std::size_t id,
+                   Tick due );
+
+    void cancel( const std::size_t id )
+      {
+          M_due[id] = NONE;
+      }
+
+    /*!
+      \brief advance to the next tick
+      \param ids the ids due at the new tick, in the order they were
+      scheduled.  They are no longer scheduled.
+     */
+    void advance( std::vector< std::size_t > & ids );
+};
+
+#endif
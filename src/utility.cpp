@@ -240,3 +240,28 @@ tildeExpand( const std::string & path_name )
 
 #endif
 }
+
+
+/*
+ *==================================================================
+ *Part:     Signal Mask
+ *==================================================================
+ */
+
+#ifndef RCSS_WIN
+#  include <csignal>
+#  include <pthread.h>
+#endif
+
+void
+blockTerminationSignals()
+{
+#ifndef RCSS_WIN
+    sigset_t signals;
+    sigemptyset( &signals );
+    sigaddset( &signals, SIGINT );
+    sigaddset( &signals, SIGTERM );
+    sigaddset( &signals, SIGHUP );
+    pthread_sigmask( SIG_BLOCK, &signals, nullptr );
+#endif
+}
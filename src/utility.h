@@ -152,4 +152,10 @@ bound( const T & low,
 std::string
 tildeExpand( const std::string & path_name );
 
+// Blocks SIGINT, SIGTERM and SIGHUP in the calling thread, so that they
+// are only delivered to the main thread.  Called first by every helper
+// thread.
+void
+blockTerminationSignals();
+
 #endif
@@ -0,0 +1,163 @@
+// -*-c++-*-
+
+/***************************************************************************
+                             visualgeometry.cpp
+              Batched geometry of the objects in a player's visual
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "visualgeometry.h"
+
+#include "utility.h"
+
+#include <cmath>
+
+void
+VisualGeometry::clear()
+{
+    M_x.clear();
+    M_y.clear();
+    M_vel_x.clear();
+    M_vel_y.clear();
+    M_qstep.clear();
+    M_quantize.clear();
+}
+
+std::size_t
+VisualGeometry::add( const PVector & pos,
+                     const PVector & vel,
+                     const double & qstep,
+                     const bool quantize )
+{
+    M_x.push_back( pos.x );
+    M_y.push_back( pos.y );
+    M_vel_x.push_back( vel.x );
+    M_vel_y.push_back( vel.y );
+    M_qstep.push_back( qstep );
+    M_quantize.push_back( quantize ? 1 : 0 );
+    return M_x.size() - 1;
+}
+
+void
+VisualGeometry::compute( const PVector & pos,
+                         const PVector & vel,
+                         const double & body,
+                         const double & neck,
+                         const double & visible_angle,
+                         const double & dir_qstep,
+                         const bool velocity )
+{
+    const std::size_t n = size();
+
+    M_dx.resize( n );
+    M_dy.resize( n );
+    M_dist2.resize( n );
+    M_dist.resize( n );
+    M_dir.resize( n );
+    M_visible.resize( n );
+    M_quant_dist.resize( n );
+    M_dist_chg.resize( n );
+    M_dir_chg.resize( n );
+
+    const double * x = M_x.data();
+    const double * y = M_y.data();
+    double * dx = M_dx.data();
+    double * dy = M_dy.data();
+    double * dist2 = M_dist2.data();
+    double * dist = M_dist.data();
+
+    //
+    // offsets and distances.
+    // the squares of ( pos - obj ) and ( obj - pos ) are the same, so
+    // dist2 matches PVector::distance2 from the player.
+    //
+    const double px = pos.x;
+    const double py = pos.y;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        dx[i] = x[i] - px;
+        dy[i] = y[i] - py;
+        dist2[i] = dx[i]*dx[i] + dy[i]*dy[i];
+    }
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        dist[i] = std::sqrt( dist2[i] );
+    }
+
+    //
+    // directions, as Player::angleFromBody followed by the neck angle
+    //
+    const double half_angle = visible_angle * 0.5;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        const double th = ( dx[i] == 0.0 && dy[i] == 0.0
+                            ? 0.0
+                            : std::atan2( dy[i], dx[i] ) );
+        M_dir[i] = normalize_angle( normalize_angle( th - body ) - neck );
+        M_visible[i] = ( std::fabs( M_dir[i] ) < half_angle ? 1 : 0 );
+    }
+
+    //
+    // quantized distances and changes, only for the objects that are
+    // going to be reported with them
+    //
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        if ( ! M_visible[i]
+             || ! M_quantize[i] )
+        {
+            continue;
+        }
+
+        const double quant_dist
+            = Quantize( std::exp( Quantize( std::log( dist[i] + EPS ), M_qstep[i] ) ), 0.1 );
+        M_quant_dist[i] = quant_dist;
+
+        if ( ! velocity )
+        {
+            continue;
+        }
+
+        if ( dist[i] != 0.0 )
+        {
+            const double vtmp_x = M_vel_x[i] - vel.x;
+            const double vtmp_y = M_vel_y[i] - vel.y;
+            const double etmp_x = dx[i] / dist[i];
+            const double etmp_y = dy[i] / dist[i];
+
+            double dist_chg = vtmp_x * etmp_x + vtmp_y * etmp_y;
+            double dir_chg = vtmp_y * etmp_x - vtmp_x * etmp_y;
+            dir_chg /= dist[i];
+            dir_chg *= RAD2DEG;
+
+            M_dir_chg[i] = ( dir_chg == 0.0
+                             ? 0.0
+                             : Quantize( dir_chg, dir_qstep ) );
+            M_dist_chg[i] = ( quant_dist
+                              * Quantize( dist_chg / dist[i], 0.02 ) );
+        }
+        else
+        {
+            M_dir_chg[i] = 0.0;
+            M_dist_chg[i] = 0.0;
+        }
+    }
+}
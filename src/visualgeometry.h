@@ -0,0 +1,150 @@
+// -*-c++-*-
+
+/***************************************************************************
+                              visualgeometry.h
+              Batched geometry of the objects in a player's visual
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_VISUALGEOMETRY_H
+#define RCSSSERVER_VISUALGEOMETRY_H
+
+#include "object.h"
+
+#include <vector>
+#include <cstddef>
+
+/*!
+  \class VisualGeometry
+  \brief the relative geometry of every object in one visual message.
+
+  The positions and velocities of the objects are collected into
+  separate arrays, and compute() works through them one quantity at a
+  time: the offsets and squared distances, the raw distances, the
+  directions and the view cone test, and then the quantized distances
+  and changes of the objects in the view cone.  The arithmetic loops
+  have no branches or calls, so the compiler can vectorize them.
+
+  Every value is computed with the same expressions, in the same order,
+  as the per object code in VisualSenderPlayerV1 did, so the results
+  are bit-identical to it.  Nothing here draws random numbers, which
+  keeps the draws of the visual sender in their original order.
+ */
+class VisualGeometry {
+private:
+    // inputs
+    std::vector< double > M_x;
+    std::vector< double > M_y;
+    std::vector< double > M_vel_x;
+    std::vector< double > M_vel_y;
+    std::vector< double > M_qstep;
+    std::vector< unsigned char > M_quantize;
+
+    // outputs
+    std::vector< double > M_dx;
+    std::vector< double > M_dy;
+    std::vector< double > M_dist2;
+    std::vector< double > M_dist;
+    std::vector< double > M_dir;
+    std::vector< unsigned char > M_visible;
+    std::vector< double > M_quant_dist;
+    std::vector< double > M_dist_chg;
+    std::vector< double > M_dir_chg;
+
+public:
+
+    void clear();
+
+    std::size_t size() const
+      {
+          return M_x.size();
+      }
+
+    /*!
+      \brief append an object
+      \param qstep the quantize step for its distance
+      \param quantize true if its quantized distance is needed when it
+      is in the view cone
+      \return the index of the object
+     */
+    std::size_t add( const PVector & pos,
+                     const PVector & vel,
+                     const double & qstep,
+                     const bool quantize );
+
+    /*!
+      \brief compute the geometry of all objects as seen by a player
+      \param pos the position of the player
+      \param vel the velocity of the player
+      \param body the committed body angle of the player
+      \param neck the committed neck angle of the player
+      \param visible_angle the width of the view cone
+      \param dir_qstep the quantize step for direction changes
+      \param velocity true if the distance and direction changes of the
+      quantized objects are needed
+     */
+    void compute( const PVector & pos,
+                  const PVector & vel,
+                  const double & body,
+                  const double & neck,
+                  const double & visible_angle,
+                  const double & dir_qstep,
+                  const bool velocity );
+
+    //! the squared distance
+    double dist2( const std::size_t i ) const
+      {
+          return M_dist2[i];
+      }
+
+    //! the distance
+    double dist( const std::size_t i ) const
+      {
+          return M_dist[i];
+      }
+
+    //! the direction relative to the face in radians
+    double dir( const std::size_t i ) const
+      {
+          return M_dir[i];
+      }
+
+    //! true if the object is in the view cone
+    bool visible( const std::size_t i ) const
+      {
+          return M_visible[i] != 0;
+      }
+
+    //! only valid for a visible object added with quantize
+    double quantDist( const std::size_t i ) const
+      {
+          return M_quant_dist[i];
+      }
+
+    //! only valid for a visible object added with quantize
+    double distChg( const std::size_t i ) const
+      {
+          return M_dist_chg[i];
+      }
+
+    //! only valid for a visible object added with quantize
+    double dirChg( const std::size_t i ) const
+      {
+          return M_dir_chg[i];
+      }
+};
+
+#endif
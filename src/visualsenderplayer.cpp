@@ -52,7 +52,11 @@ VisualSenderPlayer::VisualSenderPlayer( const Params & params )
       M_serializer( params.M_serializer ),
       M_self( params.M_self ),
       M_stadium( params.M_stadium ),
-      M_sendcnt( 0 )
+      // the step is drawn, so that a sender created again for the
+      // same player does not repeat the numbers of the previous one
+      M_rng( DefaultRNG::stream( DefaultRNG::VISUAL_NOISE,
+                                 params.M_self.id(),
+                                 DefaultRNG::instance()() ) )
 {
     //std::cerr << "create VisualSenderPlayer" << std::endl;
 }
@@ -65,108 +69,284 @@ VisualSenderPlayer::~VisualSenderPlayer()
 /*!
 //===================================================================
 //
-//  CLASS: VisualSensorPlayerV1
+//  CLASS: VisualSenderPlayerCommon
 //
-//  DESC: Class for the version 1* visual protocol.  This version is
-//        completely unused as far as I am aware of, but it is here
-//        none the less, just in case there is someone somewhere
-//        still using it.
-//
-//        * It's version 1 to the simualtor in it's current form.
-//        From what I know the original simulator was written in
-//        lisp and the first C++ version was actually version 3.  I
-//        don't know if the protocol was compatible with previous
-//        versions, so this may well be the version 3 protocol.
+//  DESC: The parts of the visual protocol for players that are the
+//        same in all the versions.
 //
 //===================================================================
 */
 
-VisualSenderPlayerV1::VisualSenderPlayerV1( const Params & params )
-    : VisualSenderPlayer( params )
+VisualSenderPlayerCommon::VisualSenderPlayerCommon( const Params & params )
+    : VisualSenderPlayer( params ),
+      M_ball( nullptr )
 {
 
 }
 
-VisualSenderPlayerV1::~VisualSenderPlayerV1()
+VisualSenderPlayerCommon::~VisualSenderPlayerCommon()
 {
 
 }
 
 void
-VisualSenderPlayerV1::sendVisual()
+VisualSenderPlayerCommon::collectObjects()
+{
+    const bool high = self().highQuality();
+
+    M_flags.clear();
+    M_ball = nullptr;
+    M_players.clear();
+    M_geometry.clear();
+
+    const std::vector< PObject * > & landmarks = stadium().field().landmarks();
+    stadium().field().landmarksInView( self().pos(),
+                                       self().angleBodyCommitted() + self().angleNeckCommitted(),
+                                       self().visibleAngle() * 0.5,
+                                       self().VISIBLE_DISTANCE,
+                                       M_landmark_candidates );
+    for ( const std::size_t i : M_landmark_candidates )
+    {
+        const PObject * o = landmarks[i];
+        if ( o->objectVersion() <= self().version() )
+        {
+            M_flags.push_back( o );
+            M_geometry.add( o->pos(), PVector(), self().landDistQStep(), high );
+        }
+    }
+
+    if ( stadium().ball().objectVersion() <= self().version() )
+    {
+        M_ball = &stadium().ball();
+        M_geometry.add( M_ball->pos(), M_ball->vel(), self().distQStep(), high );
+    }
+
+    for ( Stadium::PlayerCont::const_reference p : stadium().players() )
+    {
+        if ( p != &self()
+             && p->isEnabled()
+             && p->objectVersion() <= self().version() )
+        {
+            M_players.push_back( p );
+            // the low quality view also picks the name by distance
+            M_geometry.add( p->pos(), p->vel(), self().distQStep(), true );
+        }
+    }
+}
+
+void
+VisualSenderPlayerCommon::computeGeometry()
+{
+    M_geometry.compute( self().pos(),
+                        self().vel(),
+                        self().angleBodyCommitted(),
+                        self().angleNeckCommitted(),
+                        self().visibleAngle(),
+                        self().dirQStep(),
+                        self().highQuality() );
+}
+
+bool
+VisualSenderPlayerCommon::calcLine( const PObject & line,
+                                    double & sight_2_line_ang,
+                                    double & player_2_line ) const
 {
-    incSendCount();
+    /*! the angle of an outward pointing normal ( 90degs to ) to
+      the line */
+    double line_normal;
+
+    //! the x of y value of where the line starts
+    double line_start;
 
-    if ( sendCount() >= self().visualSendInterval() )
+    //! the x or y value of where the line stops
+    double line_stop;
+
+    //! a flag to specify if the line is vertical or horizontal
+    bool vert;
+
+    /*! be very carefull here.  The lines pos.x is actually it's
+      distance from the center of the field, not neccesarily it's
+      x position. */
+
+    //! left line
+    if ( line.pos().x == - ServerParam::PITCH_LENGTH*0.5 )
     {
-        resetSendCount();
+        line_normal = M_PI;
+        if ( self().pos().x < line.pos().x )
+            line_normal = 0.0;
+        player_2_line = line.pos().x - self().pos().x;
+        line_start = - ServerParam::PITCH_WIDTH*0.5;
+        line_stop = ServerParam::PITCH_WIDTH*0.5;
+        vert = true;
     }
+    //! right line
+    else if ( line.pos().x == ServerParam::PITCH_LENGTH*0.5 )
+    {
+        line_normal = 0.0;
+        if( self().pos().x > line.pos().x )
+            line_normal = M_PI;
+        player_2_line = line.pos().x - self().pos().x;
+        line_start = - ServerParam::PITCH_WIDTH*0.5;
+        line_stop = ServerParam::PITCH_WIDTH*0.5;
+        vert = true;
+    }
+    //! top line
+    else if ( line.pos().x == - ServerParam::PITCH_WIDTH*0.5 )
+    {
+        line_normal = -M_PI*0.5;
+        if ( self().pos().y < line.pos().x )
+            line_normal = M_PI*0.5;
+        player_2_line = line.pos().x - self().pos().y;
+        line_start = - ServerParam::PITCH_LENGTH*0.5;
+        line_stop = ServerParam::PITCH_LENGTH*0.5;
+        vert = false;
+    }
+    //! bottom line
+    else if ( line.pos().x == ServerParam::PITCH_WIDTH*0.5 )
+    {
+        line_normal = M_PI*0.5;
+        if ( self().pos().y > line.pos().x )
+            line_normal = -M_PI*0.5;
+        player_2_line = line.pos().x - self().pos().y;
+        line_start = - ServerParam::PITCH_LENGTH*0.5;
+        line_stop = ServerParam::PITCH_LENGTH*0.5;
+        vert = false;
+    }
+    else
+    {
+        std::cerr << __FILE__ << ": " << __LINE__
+                  << ": Error, unknown line: " << line << std::endl;
+        return false;
+    }
+
+    //! angle between the players line of sight and the line's normal
+    sight_2_line_ang = calcLineRadDir( line_normal );
+
+    /*! if the angle between the line of sight and the line's norm
+      is not within -90.0 and 90 degrees then the player is
+      looking parallel or away from the line, thus it cannot be
+      visible. */
+    if ( std::fabs( sight_2_line_ang ) >= M_PI*0.5 )
+    {
+        return false;
+    }
+
+    /*! this gives us the x or y offset from the player for where
+      their line of sight intersects the line */
+    double line_intersect = player_2_line * std::tan( sight_2_line_ang );
+
+    /*! this calculates the actual x or y value for where the line
+      of sight intersects the line.  Because the y axis is
+      inverted, we need to use -line_intersect if the line is
+      vertical. */
+    if ( vert )
+        line_intersect = self().pos().y - line_intersect;
     else
+        line_intersect += self().pos().x;
+
+    /*! If the point that the players line of sight intersects the
+      line beyond it's beginning or end then the player wont see
+      this line */
+    if ( line_intersect < line_start
+         || line_intersect > line_stop )
     {
-        return;
+        return false;
     }
 
+    return true;
+}
+
+/*!
+//===================================================================
+//
+//  CLASS: VisualSenderPlayerT
+//
+//  DESC: The visual protocol for players, compiled for the naming,
+//        the rounding of directions and the player fields of a
+//        version.
+//
+//===================================================================
+*/
+
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
+VisualSenderPlayerT< Names, Dirs, FIELDS >::VisualSenderPlayerT( const Params & params )
+    : VisualSenderPlayerCommon( params )
+{
+
+}
+
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
+VisualSenderPlayerT< Names, Dirs, FIELDS >::~VisualSenderPlayerT()
+{
+
+}
+
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
+void
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendVisual()
+{
+    // Stadium calls this only when the visual is due
+
     serializer().serializeVisualBegin( transport(), stadium().time() );
+
+    collectObjects();
+    computeGeometry();
+
+    // the quality is chosen once for the whole visual
     if ( self().highQuality() )
     {
-        M_send_flag = &VisualSenderPlayerV1::sendHighFlag;
-        M_send_ball = &VisualSenderPlayerV1::sendHighBall;
-        M_send_player = &VisualSenderPlayerV1::sendHighPlayer;
-        M_serialize_line = &VisualSenderPlayerV1::serializeHighLine;
+        sendObjects< true >();
     }
     else
     {
-        M_send_flag = &VisualSenderPlayerV1::sendLowFlag;
-        M_send_ball = &VisualSenderPlayerV1::sendLowBall;
-        M_send_player = &VisualSenderPlayerV1::sendLowPlayer;
-        M_serialize_line = &VisualSenderPlayerV1::serializeLowLine;
+        sendObjects< false >();
     }
-    sendFlags();
-    sendBalls();
-    sendPlayers();
-    sendLines();
+
     serializer().serializeVisualEnd( transport() );
     transport() << std::ends << std::flush;
 }
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
+template < bool HIGH >
 void
-VisualSenderPlayerV1::sendFlags()
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendObjects()
 {
-    for ( const PObject * o : stadium().field().landmarks() )
+    for ( std::size_t i = 0; i < M_flags.size(); ++i )
     {
-        if ( o->objectVersion() <= self().version() )
-        {
-            sendFlag( *o );
-        }
+        if ( HIGH ) sendHighFlag( *M_flags[i], i );
+        else sendLowFlag( *M_flags[i], i );
     }
-}
 
-void
-VisualSenderPlayerV1::sendBalls()
-{
-    if ( stadium().ball().objectVersion() <= self().version() )
+    if ( M_ball )
     {
-        sendBall( stadium().ball() );
+        if ( HIGH ) sendHighBall( *M_ball, M_flags.size() );
+        else sendLowBall( *M_ball, M_flags.size() );
     }
-}
 
-void
-VisualSenderPlayerV1::sendPlayers()
-{
-    for ( Stadium::PlayerCont::const_reference p : stadium().players() )
+    const std::size_t first = M_flags.size() + ( M_ball ? 1 : 0 );
+    for ( std::size_t i = 0; i < M_players.size(); ++i )
     {
-        if ( p != &self()
-             && p->isEnabled()
-             && p->objectVersion() <= self().version() )
-        {
-            sendPlayer( *p );
-        }
+        if ( HIGH ) sendHighPlayer( *M_players[i], first + i );
+        else sendLowPlayer( *M_players[i], first + i );
     }
-}
 
+    sendLines< HIGH >();
+}
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
+template < bool HIGH >
 void
-VisualSenderPlayerV1::sendLines()
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendLines()
 {
     int line_count = 0;
     int max_line_count;
@@ -185,25 +365,25 @@ VisualSenderPlayerV1::sendLines()
     if ( line_count < max_line_count
          && stadium().field().line_l.objectVersion() <= self().version() )
     {
-        if ( sendLine( stadium().field().line_l ) )
+        if ( sendLine< HIGH >( stadium().field().line_l ) )
             ++line_count;
     }
     if ( line_count < max_line_count
          && stadium().field().line_r.objectVersion() <= self().version() )
     {
-        if( sendLine( stadium().field().line_r ) )
+        if( sendLine< HIGH >( stadium().field().line_r ) )
             ++line_count;
     }
     if ( line_count < max_line_count
          && stadium().field().line_t.objectVersion() <= self().version() )
     {
-        if ( sendLine( stadium().field().line_t ) )
+        if ( sendLine< HIGH >( stadium().field().line_t ) )
             ++line_count;
     }
     if ( line_count < max_line_count
          && stadium().field().line_b.objectVersion() <= self().version() )
     {
-        if ( sendLine( stadium().field().line_b ) )
+        if ( sendLine< HIGH >( stadium().field().line_b ) )
             ++line_count;
     }
     if ( line_count < min_line_count )
@@ -214,37 +394,41 @@ VisualSenderPlayerV1::sendLines()
     }
 }
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::sendLowFlag( const PObject & flag )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendLowFlag( const PObject & flag,
+                                                         const std::size_t i )
 {
-    const double ang = calcRadDir( flag );
+    const double ang = M_geometry.dir( i );
 
-    if ( std::fabs( ang ) < self().visibleAngle() * 0.5 )
+    if ( M_geometry.visible( i ) )
     {
         serializer().serializeVisualObject( transport(),
-                                            calcName( flag ),
+                                            Names::name( flag ),
                                             calcDegDir( ang ) );
     }
-    else if ( calcUnQuantDist( flag ) <= self().VISIBLE_DISTANCE )
+    else if ( M_geometry.dist( i ) <= self().VISIBLE_DISTANCE )
     {
         serializer().serializeVisualObject( transport(),
-                                            calcCloseName( flag ),
+                                            Names::closeName( flag ),
                                             calcDegDir( ang ) );
     }
 }
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::sendHighFlag( const PObject & flag )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendHighFlag( const PObject & flag,
+                                                          const std::size_t i )
 {
-    const double ang = calcRadDir( flag );
-    //const double un_quant_dist = calcUnQuantDist( flag );
-    double un_quant_dist = self().pos().distance2( flag.pos() );
+    const double ang = M_geometry.dir( i );
 
-    if ( std::fabs( ang ) < self().visibleAngle() * 0.5 )
+    if ( M_geometry.visible( i ) )
     {
-        un_quant_dist = std::sqrt( un_quant_dist );
-        const double quant_dist
-            = calcQuantDist( un_quant_dist, self().landDistQStep() );
+        const double quant_dist = M_geometry.quantDist( i );
 
         //const double prob = ( ( quant_dist - UNUM_FAR_LENGTH )
         //                      / ( UNUM_TOOFAR_LENGTH - UNUM_FAR_LENGTH ) );
@@ -254,67 +438,66 @@ VisualSenderPlayerV1::sendHighFlag( const PObject & flag )
         if ( decide( prob ) )
         {
             serializer().serializeVisualObject( transport(),
-                                                calcName( flag ),
+                                                Names::name( flag ),
                                                 quant_dist,
                                                 calcDegDir( ang ) );
         }
         else
         {
-            double dist_chg, dir_chg;
-            calcVel( PVector(), flag.pos(),
-                     un_quant_dist, quant_dist,
-                     dist_chg, dir_chg );
             serializer().serializeVisualObject( transport(),
-                                                calcName( flag ),
+                                                Names::name( flag ),
                                                 quant_dist,
                                                 calcDegDir( ang ),
-                                                dist_chg,
-                                                dir_chg );
+                                                M_geometry.distChg( i ),
+                                                M_geometry.dirChg( i ) );
         }
     }
-    else if ( un_quant_dist <= self().VISIBLE_DISTANCE2 )
+    else if ( M_geometry.dist2( i ) <= self().VISIBLE_DISTANCE2 )
     {
-        //un_quant_dist = std::sqrt( un_quant_dist );
         serializer().serializeVisualObject( transport(),
-                                            calcCloseName( flag ),
-                                            calcQuantDist( std::sqrt( un_quant_dist ),
+                                            Names::closeName( flag ),
+                                            calcQuantDist( M_geometry.dist( i ),
                                                            self().landDistQStep() ),
                                             calcDegDir( ang ) );
     }
 }
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::sendLowBall( const MPObject & ball )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendLowBall( const MPObject & ball,
+                                                         const std::size_t i )
 {
-    const double ang = calcRadDir( ball );
+    const double ang = M_geometry.dir( i );
 
-    if( std::fabs( ang ) < self().visibleAngle() * 0.5 )
+    if( M_geometry.visible( i ) )
     {
         serializer().serializeVisualObject( transport(),
-                                            calcName( ball ),
+                                            Names::name( ball ),
                                             calcDegDir( ang ) );
     }
-    else if( calcUnQuantDist( ball ) <= self().VISIBLE_DISTANCE )
+    else if( M_geometry.dist( i ) <= self().VISIBLE_DISTANCE )
     {
         serializer().serializeVisualObject( transport(),
-                                            calcCloseName( ball ),
+                                            Names::closeName( ball ),
                                             calcDegDir( ang ) );
     }
 }
 
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::sendHighBall( const MPObject & ball )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendHighBall( const MPObject & ball,
+                                                          const std::size_t i )
 {
-    const double ang = calcRadDir( ball );
-    //const double un_quant_dist = calcUnQuantDist( ball );
-    double un_quant_dist = self().pos().distance2( ball.pos() );
+    const double ang = M_geometry.dir( i );
 
-    if ( std::fabs( ang ) < self().visibleAngle() * 0.5 )
+    if ( M_geometry.visible( i ) )
     {
-        un_quant_dist = std::sqrt( un_quant_dist );
-        const double quant_dist = calcQuantDist( un_quant_dist,
-                                                 self().distQStep() );
+        const double quant_dist = M_geometry.quantDist( i );
 
         //double prob = ( ( quant_dist - UNUM_FAR_LENGTH )
         //                / ( UNUM_TOOFAR_LENGTH - UNUM_FAR_LENGTH ) );
@@ -324,45 +507,42 @@ VisualSenderPlayerV1::sendHighBall( const MPObject & ball )
         if ( decide( prob ) )
         {
             serializer().serializeVisualObject( transport(),
-                                                calcName( ball ),
+                                                Names::name( ball ),
                                                 quant_dist,
                                                 calcDegDir( ang ) );
         }
         else
         {
-            double dist_chg, dir_chg;
-            calcVel( ball.vel(), ball.pos(),
-                     un_quant_dist, quant_dist,
-                     dist_chg, dir_chg );
             serializer().serializeVisualObject( transport(),
-                                                calcName( ball ),
+                                                Names::name( ball ),
                                                 quant_dist,
                                                 calcDegDir( ang ),
-                                                dist_chg,
-                                                dir_chg );
+                                                M_geometry.distChg( i ),
+                                                M_geometry.dirChg( i ) );
         }
     }
-    else if ( un_quant_dist <= self().VISIBLE_DISTANCE2 )
+    else if ( M_geometry.dist2( i ) <= self().VISIBLE_DISTANCE2 )
     {
         serializer().serializeVisualObject( transport(),
-                                            calcCloseName( ball ),
-                                            calcQuantDist( std::sqrt( un_quant_dist ),
+                                            Names::closeName( ball ),
+                                            calcQuantDist( M_geometry.dist( i ),
                                                            self().distQStep() ),
                                             calcDegDir( ang ) );
     }
 }
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::sendLowPlayer( const Player & player )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendLowPlayer( const Player & player,
+                                                           const std::size_t i )
 {
-    const double ang = calcRadDir( player );
-    //const double un_quant_dist = calcUnQuantDist( player );
-    const double un_quant_dist2 = self().pos().distance2( player.pos() );
+    const double ang = M_geometry.dir( i );
 
-    if ( std::fabs( ang ) < self().visibleAngle() * 0.5 )
+    if ( M_geometry.visible( i ) )
     {
-        const double quant_dist = calcQuantDist( std::sqrt( un_quant_dist2 ),
-                                                 self().distQStep() );
+        const double quant_dist = M_geometry.quantDist( i );
 
         //double prob = ( ( quant_dist - TEAM_FAR_LENGTH )
         //              / ( TEAM_TOOFAR_LENGTH - TEAM_FAR_LENGTH ) );
@@ -371,7 +551,7 @@ VisualSenderPlayerV1::sendLowPlayer( const Player & player )
         if ( decide( prob ) )
         {
             serializer().serializeVisualObject( transport(),
-                                                calcTFarName( player ),
+                                                Names::teamFarName( player ),
                                                 calcDegDir( ang ) );
         }
         else
@@ -383,38 +563,38 @@ VisualSenderPlayerV1::sendLowPlayer( const Player & player )
             if ( decide( prob ) )
             {
                 serializer().serializeVisualObject( transport(),
-                                                    calcUFarName( player ),
+                                                    Names::unumFarName( self(), player ),
                                                     calcDegDir( ang ) );
             }
             else
             {
                 serializer().serializeVisualObject( transport(),
-                                                    calcPlayerName( player ),
+                                                    Names::playerName( self(), player ),
                                                     calcDegDir( ang ) );
             }
         }
     }
-    else if ( un_quant_dist2 <= self().VISIBLE_DISTANCE2 )
+    else if ( M_geometry.dist2( i ) <= self().VISIBLE_DISTANCE2 )
     {
         serializer().serializeVisualObject( transport(),
-                                            calcCloseName( player ),
+                                            Names::closeName( player ),
                                             calcDegDir( ang ) );
     }
 }
 
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::sendHighPlayer( const Player & player )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendHighPlayer( const Player & player,
+                                                            const std::size_t i )
 {
-    const double ang = calcRadDir( player );
-    //const double un_quant_dist = calcUnQuantDist( player );
-    double un_quant_dist = self().pos().distance2( player.pos() );
+    const double ang = M_geometry.dir( i );
 
-    if ( std::fabs( ang ) < self().visibleAngle() * 0.5 )
+    if ( M_geometry.visible( i ) )
     {
-        un_quant_dist = std::sqrt( un_quant_dist );
-        const double quant_dist = calcQuantDist( un_quant_dist,
-                                                 self().distQStep() );
+        const double quant_dist = M_geometry.quantDist( i );
         //double prob = ( ( quant_dist - TEAM_FAR_LENGTH )
         //              / ( TEAM_TOOFAR_LENGTH - TEAM_FAR_LENGTH ) );
         double prob = ( ( quant_dist - self().teamFarLength() )
@@ -423,7 +603,7 @@ VisualSenderPlayerV1::sendHighPlayer( const Player & player )
         if ( decide( prob ) )
         {
             serializer().serializeVisualObject( transport(),
-                                                calcTFarName( player ),
+                                                Names::teamFarName( player ),
                                                 quant_dist,
                                                 calcDegDir( ang ) );
         }
@@ -437,422 +617,161 @@ VisualSenderPlayerV1::sendHighPlayer( const Player & player )
             if ( decide( prob ) )
             {
                 serializePlayer( player,
-                                 calcUFarName( player ),
+                                 Names::unumFarName( self(), player ),
                                  quant_dist,
                                  calcDegDir( ang ) );
             }
             else
             {
-                double dist_chg, dir_chg;
-                calcVel( player.vel(), player.pos(),
-                         un_quant_dist, quant_dist,
-                         dist_chg, dir_chg );
                 serializePlayer( player,
-                                 calcPlayerName( player ),
+                                 Names::playerName( self(), player ),
                                  quant_dist,
                                  calcDegDir( ang ),
-                                 dist_chg,
-                                 dir_chg );
+                                 M_geometry.distChg( i ),
+                                 M_geometry.dirChg( i ) );
             }
         }
     }
-    else if ( un_quant_dist <= player.VISIBLE_DISTANCE2 )
+    else if ( M_geometry.dist2( i ) <= player.VISIBLE_DISTANCE2 )
     {
-        //un_quant_dist = std::sqrt( un_quant_dist );
         serializer().serializeVisualObject( transport(),
-                                            calcCloseName( player ),
-                                            calcQuantDist( std::sqrt( un_quant_dist ),
+                                            Names::closeName( player ),
+                                            calcQuantDist( M_geometry.dist( i ),
                                                            self().distQStep() ),
                                             calcDegDir( ang ) );
     }
 }
-
-
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
+template < bool HIGH >
 bool
-VisualSenderPlayerV1::sendLine( const PObject & line )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::sendLine( const PObject & line )
 {
-    /*! the angle of an outward pointing normal ( 90degs to ) to
-      the line */
-    double line_normal;
-
-    //! perp distance of the player from the line
+    double sight_2_line_ang;
     double player_2_line;
-
-    //! the x of y value of where the line starts
-    double line_start;
-
-    //! the x or y value of where the line stops
-    double line_stop;
-
-    //! a flag to specify if the line is vertical or horizontal
-    bool vert;
-
-    /*! be very carefull here.  The lines pos.x is actually it's
-      distance from the center of the field, not neccesarily it's
-      x position. */
-
-    //! left line
-    if ( line.pos().x == - ServerParam::PITCH_LENGTH*0.5 )
-    {
-        line_normal = M_PI;
-        if ( self().pos().x < line.pos().x )
-            line_normal = 0.0;
-        player_2_line = line.pos().x - self().pos().x;
-        line_start = - ServerParam::PITCH_WIDTH*0.5;
-        line_stop = ServerParam::PITCH_WIDTH*0.5;
-        vert = true;
-    }
-    //! right line
-    else if ( line.pos().x == ServerParam::PITCH_LENGTH*0.5 )
-    {
-        line_normal = 0.0;
-        if( self().pos().x > line.pos().x )
-            line_normal = M_PI;
-        player_2_line = line.pos().x - self().pos().x;
-        line_start = - ServerParam::PITCH_WIDTH*0.5;
-        line_stop = ServerParam::PITCH_WIDTH*0.5;
-        vert = true;
-    }
-    //! top line
-    else if ( line.pos().x == - ServerParam::PITCH_WIDTH*0.5 )
-    {
-        line_normal = -M_PI*0.5;
-        if ( self().pos().y < line.pos().x )
-            line_normal = M_PI*0.5;
-        player_2_line = line.pos().x - self().pos().y;
-        line_start = - ServerParam::PITCH_LENGTH*0.5;
-        line_stop = ServerParam::PITCH_LENGTH*0.5;
-        vert = false;
-    }
-    //! bottom line
-    else if ( line.pos().x == ServerParam::PITCH_WIDTH*0.5 )
-    {
-        line_normal = M_PI*0.5;
-        if ( self().pos().y > line.pos().x )
-            line_normal = -M_PI*0.5;
-        player_2_line = line.pos().x - self().pos().y;
-        line_start = - ServerParam::PITCH_LENGTH*0.5;
-        line_stop = ServerParam::PITCH_LENGTH*0.5;
-        vert = false;
-    }
-    else
+    if ( ! calcLine( line, sight_2_line_ang, player_2_line ) )
     {
-        std::cerr << __FILE__ << ": " << __LINE__
-                  << ": Error, unknown line: " << line << std::endl;
         return false;
     }
 
-    //! angle between the players line of sight and the line's normal
-    double sight_2_line_ang = calcLineRadDir( line_normal );
-
-    /*! if the angle between the line of sight and the line's norm
-      is not within -90.0 and 90 degrees then the player is
-      looking parallel or away from the line, thus it cannot be
-      visible. */
-    if ( std::fabs( sight_2_line_ang ) >= M_PI*0.5 )
+    if ( HIGH )
     {
-        return false;
+        double dist = calcLineDist( sight_2_line_ang, player_2_line,
+                                    self().landDistQStep() );
+        serializer().serializeVisualObject( transport(),
+                                            Names::name( line ),
+                                            dist,
+                                            calcLineDir( sight_2_line_ang ) );
     }
-
-    /*! this gives us the x or y offset from the player for where
-      their line of sight intersects the line */
-    double line_intersect = player_2_line * std::tan( sight_2_line_ang );
-
-    /*! this calculates the actual x or y value for where the line
-      of sight intersects the line.  Because the y axis is
-      inverted, we need to use -line_intersect if the line is
-      vertical. */
-    if ( vert )
-        line_intersect = self().pos().y - line_intersect;
     else
-        line_intersect += self().pos().x;
-
-    /*! If the point that the players line of sight intersects the
-      line beyond it's beginning or end then the player wont see
-      this line */
-    if ( line_intersect < line_start
-         || line_intersect > line_stop )
     {
-        return false;
+        serializer().serializeVisualObject( transport(),
+                                            Names::name( line ),
+                                            calcLineDir( sight_2_line_ang ) );
     }
-
-    serializeLine( calcName( line ),
-                   calcLineDir( sight_2_line_ang ),
-                   sight_2_line_ang, player_2_line );
     return true;
 }
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::serializeLowLine( const std::string & name,
-                                        const int dir,
-                                        const double &, const double & )
-{
-    serializer().serializeVisualObject( transport(), name, dir );
-}
-
-void
-VisualSenderPlayerV1::serializeHighLine( const std::string & name,
-                                         const int dir,
-                                         const double & sight_2_line_ang,
-                                         const double & player_2_line )
-{
-    double dist = calcLineDist( sight_2_line_ang, player_2_line,
-                                self().landDistQStep() );
-    serializer().serializeVisualObject( transport(), name, dist, dir );
+VisualSenderPlayerT< Names, Dirs, FIELDS >::serializePlayer( const Player & player,
+                                                             const std::string & name,
+                                                             const double & dist,
+                                                             const int dir,
+                                                             const double & dist_chg,
+                                                             const double & dir_chg )
+{
+    switch ( FIELDS ) {
+    case visual::PLAYER_DIR:
+        serializer().serializeVisualObject( transport(),
+                                            name,
+                                            dist, dir,
+                                            dist_chg, dir_chg );
+        break;
+    case visual::PLAYER_BODY:
+        serializer().serializeVisualObject( transport(),
+                                            name,
+                                            dist, dir, dist_chg, dir_chg,
+                                            calcBodyDir( player ) );
+        break;
+    case visual::PLAYER_HEAD:
+        serializer().serializeVisualObject( transport(),
+                                            name,
+                                            dist, dir, dist_chg, dir_chg,
+                                            calcBodyDir( player ),
+                                            calcHeadDir( player ) );
+        break;
+    case visual::PLAYER_ARM:
+        if ( player.arm().isPointing() )
+        {
+            int point_dir = calcPointDir( player );
+            serializer().serializeVisualPlayer( transport(),
+                                                player,
+                                                name,
+                                                dist, dir,
+                                                dist_chg, dir_chg,
+                                                calcBodyDir( player ),
+                                                calcHeadDir( player ),
+                                                point_dir );
+        }
+        else
+        {
+            serializer().serializeVisualPlayer( transport(),
+                                                player,
+                                                name,
+                                                dist, dir,
+                                                dist_chg, dir_chg,
+                                                calcBodyDir( player ),
+                                                calcHeadDir( player ) );
+        }
+        break;
+    }
 }
 
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 void
-VisualSenderPlayerV1::calcVel( const PVector & obj_vel,
-                               const PVector & obj_pos,
-                               const double & un_quant_dist,
-                               const double & quant_dist,
-                               double& dist_chg,
-                               double& dir_chg ) const
+VisualSenderPlayerT< Names, Dirs, FIELDS >::serializePlayer( const Player & player,
+                                                             const std::string & name,
+                                                             const double & dist,
+                                                             const int dir )
 {
-    if ( un_quant_dist != 0.0 )
+    if ( FIELDS != visual::PLAYER_ARM )
     {
-        const PVector vtmp = obj_vel - self().vel();
-        PVector etmp = obj_pos - self().pos();
-        etmp /= un_quant_dist;
-
-        dist_chg = vtmp.x * etmp.x + vtmp.y * etmp.y;
-//         dir_chg = RAD2DEG * ( vtmp.y * etmp.x
-//                               - vtmp.x * etmp.y ) / un_quant_dist;
-        dir_chg = vtmp.y * etmp.x - vtmp.x * etmp.y;
-        dir_chg /= un_quant_dist;
-        dir_chg *= RAD2DEG;
-
-        dir_chg = ( dir_chg == 0.0
-                    ? 0.0
-                    : Quantize( dir_chg, self().dirQStep() ) );
-        dist_chg = ( quant_dist
-                     * Quantize( dist_chg
-                                 / un_quant_dist, 0.02 ) );
+        serializer().serializeVisualObject( transport(),
+                                            name,
+                                            dist,
+                                            dir );
+    }
+    else if ( player.arm().isPointing() )
+    {
+        int point_dir = calcPointDir( player );
+        serializer().serializeVisualPlayer( transport(),
+                                            player,
+                                            name,
+                                            dist,
+                                            dir,
+                                            point_dir );
     }
     else
     {
-        dir_chg = 0.0;
-        dist_chg = 0.0;
+        serializer().serializeVisualPlayer( transport(),
+                                            player,
+                                            name,
+                                            dist,
+                                            dir );
     }
 }
 
-void
-VisualSenderPlayerV1::serializePlayer( const Player &,
-                                       const std::string & name,
-                                       const double & dist,
-                                       const int dir,
-                                       const double & dist_chg,
-                                       const double & dir_chg )
-{
-    serializer().serializeVisualObject( transport(),
-                                        name,
-                                        dist, dir,
-                                        dist_chg, dir_chg );
-}
-
-void
-VisualSenderPlayerV1::serializePlayer( const Player &,
-                                       const std::string & name,
-                                       const double & dist,
-                                       const int dir )
-{
-    serializer().serializeVisualObject( transport(),
-                                        name,
-                                        dist,
-                                        dir );
-}
-
-// const
-// std::string &
-// VisualSenderPlayerV1::calcName( const PObject & obj ) const
-// {
-//     return obj.name();
-// }
-
-// const
-// std::string &
-// VisualSenderPlayerV1::calcCloseName( const PObject & obj ) const
-// {
-//     return obj.closeName();
-// }
-
-// const
-// std::string &
-// VisualSenderPlayerV1::calcTFarName( const Player & obj ) const
-// {
-//     return obj.nameTooFar();
-// }
-
-// const
-// std::string &
-// VisualSenderPlayerV1::calcUFarName( const Player & obj ) const
-// {
-//     return obj.nameFar();
-// }
-
-/*!
-//===================================================================
-//
-//  CLASS: VisualSenderPlayerV4
-//
-//  DESC: Class for the version 4 visual protocol.  This version
-//        introduced body directions of players. Everything else is
-//        the same.
-//
-//===================================================================
-*/
-
-VisualSenderPlayerV4::VisualSenderPlayerV4( const Params & params )
-    : VisualSenderPlayerV1( params )
-{
-
-}
-
-VisualSenderPlayerV4::~VisualSenderPlayerV4()
-{
-
-}
-
-void
-VisualSenderPlayerV4::serializePlayer( const Player & player,
-                                       const std::string & name,
-                                       const double & dist,
-                                       const int dir,
-                                       const double & dist_chg,
-                                       const double & dir_chg )
-{
-    serializer().serializeVisualObject( transport(),
-                                        name,
-                                        dist, dir, dist_chg, dir_chg,
-                                        calcBodyDir( player ) );
-}
-
-// int
-// VisualSenderPlayerV4::calcBodyDir( const Player & player ) const
-// {
-//     return rad2Deg( normalize_angle( player.angleBodyCommitted()
-//                                      - self().angleBodyCommitted()
-//                                      - self().angleNeckCommitted() ) );
-// }
-
-/*!
-//===================================================================
-//
-//  CLASS: VisualSensorPlayerV5
-//
-//  DESC: Class for the version 5 visual protocol.  This version
-//        introduced head directions of players. Everything else is
-//        the same
-//
-//===================================================================
-*/
-
-
-VisualSenderPlayerV5::VisualSenderPlayerV5( const Params & params )
-    : VisualSenderPlayerV4( params )
-{
-
-}
-
-
-VisualSenderPlayerV5::~VisualSenderPlayerV5()
-{
-
-}
-
-void
-VisualSenderPlayerV5::serializePlayer( const Player & player,
-                                       const std::string & name,
-                                       const double & dist,
-                                       const int dir,
-                                       const double & dist_chg,
-                                       const double & dir_chg )
-{
-    serializer().serializeVisualObject( transport(),
-                                        name,
-                                        dist, dir, dist_chg, dir_chg,
-                                        calcBodyDir( player ),
-                                        calcHeadDir( player ) );
-}
-
-/*!
-//===================================================================
-//
-//  CLASS: VisualSensorPlayerV6
-//
-//  DESC: Class for the version 6 visual protocol.  This version
-//        introduced shortened names for all the objects meaning the
-//        name calculation must be redefined.
-//
-//===================================================================
-*/
-
-VisualSenderPlayerV6::VisualSenderPlayerV6( const Params & params )
-    : VisualSenderPlayerV5( params )
-{
-
-}
-
-VisualSenderPlayerV6::~VisualSenderPlayerV6()
-{
-
-}
-
-/*!
-//===================================================================
-//
-//  CLASS: VisualSensorPlayerV7
-//
-//  DESC: Class for the version 7 visual protocol.  This version
-//        fixed a bug in the generation of directions in that they
-//        were truncated to int, rather than rounded.  This meant
-//        error in the direction pointed was at most times between
-//        -0.5 and +0.5 degrees, but occationally between -1.0 and
-//        +1.0 degrees and at other times exact.  With the new method
-//        of rounding, the error is always between -0.5 and +0.5.
-//
-//===================================================================
-*/
-
-VisualSenderPlayerV7::VisualSenderPlayerV7( const Params & params )
-    : VisualSenderPlayerV6( params )
-{
-
-}
-
-VisualSenderPlayerV7::~VisualSenderPlayerV7()
-{
-
-}
-
-
-/*!
-//===================================================================
-//
-//  CLASS: VisualSensorPlayerV8
-//
-//  DESC: Class for the version 8 visual protocol.  This version
-//        introduced observation of the a new arm feature, that
-//        allows plays to point to different spots, however, on
-//        direction the arm is pointing to is visable, not the
-//        distance to the spot the arm is pointing to.
-//
-//===================================================================
-*/
-
-VisualSenderPlayerV8::VisualSenderPlayerV8( const Params & params )
-    : VisualSenderPlayerV7( params )
-{
-
-}
-
-VisualSenderPlayerV8::~VisualSenderPlayerV8()
-{
-
-}
-
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
 int
-VisualSenderPlayerV8::calcPointDir( const Player & player )
+VisualSenderPlayerT< Names, Dirs, FIELDS >::calcPointDir( const Player & player )
 {
     double dir = 0.0;
     //if ( player.getArmDir( dir ) )
@@ -889,7 +808,7 @@ VisualSenderPlayerV8::calcPointDir( const Player & player )
         //the distance of the player.  95% of the returned random values
         //will be within +- 2*sigma of dir
         std::normal_distribution<> dst( dir, sigma );
-        return rad2Deg( normalize_angle( dst( DefaultRNG::instance() ) ) );
+        return calcDegDir( normalize_angle( dst( rng() ) ) );
     }
     else
     {
@@ -897,144 +816,28 @@ VisualSenderPlayerV8::calcPointDir( const Player & player )
     }
 }
 
-// void
-// VisualSenderPlayerV8::serializePlayer( const Player & player,
-//                                        const std::string & name,
-//                                        const double & dist,
-//                                        const int dir,
-//                                        const double & dist_chg,
-//                                        const double & dir_chg )
-// {
-//     if ( player.arm().isPointing() )
-//     {
-//         int point_dir = calcPointDir( player );
-//         serializer().serializeVisualObject( transport(),
-//                                             name,
-//                                             dist, dir,
-//                                             dist_chg, dir_chg,
-//                                             calcBodyDir( player ),
-//                                             calcHeadDir( player ),
-//                                             point_dir,
-//                                             player.isTackling() );
-//     }
-//     else
-//     {
-//         serializer().serializeVisualObject( transport(),
-//                                             name,
-//                                             dist, dir,
-//                                             dist_chg, dir_chg,
-//                                             calcBodyDir( player ),
-//                                             calcHeadDir( player ),
-//                                             player.isTackling() );
-//     }
-// }
-
-// void
-// VisualSenderPlayerV8::serializePlayer( const Player & player,
-//                                        const std::string & name,
-//                                        const double & dist,
-//                                        const int dir )
-// {
-//     if ( player.arm().isPointing() )
-//     {
-//         int point_dir = calcPointDir( player );
-//         serializer().serializeVisualObject( transport(),
-//                                             name,
-//                                             dist,
-//                                             dir,
-//                                             point_dir,
-//                                             player.isTackling() );
-//     }
-//     else
-//     {
-//         serializer().serializeVisualObject( transport(),
-//                                             name,
-//                                             dist,
-//                                             dir,
-//                                             player.isTackling() );
-//     }
-// }
-
-void
-VisualSenderPlayerV8::serializePlayer( const Player & player,
-                                       const std::string & name,
-                                       const double & dist,
-                                       const int dir,
-                                       const double & dist_chg,
-                                       const double & dir_chg )
-{
-    if ( player.arm().isPointing() )
-    {
-        int point_dir = calcPointDir( player );
-        serializer().serializeVisualPlayer( transport(),
-                                            player,
-                                            name,
-                                            dist, dir,
-                                            dist_chg, dir_chg,
-                                            calcBodyDir( player ),
-                                            calcHeadDir( player ),
-                                            point_dir );
-    }
-    else
-    {
-        serializer().serializeVisualPlayer( transport(),
-                                            player,
-                                            name,
-                                            dist, dir,
-                                            dist_chg, dir_chg,
-                                            calcBodyDir( player ),
-                                            calcHeadDir( player ) );
-    }
-}
-
-void
-VisualSenderPlayerV8::serializePlayer( const Player & player,
-                                       const std::string & name,
-                                       const double & dist,
-                                       const int dir )
-{
-    if ( player.arm().isPointing() )
-    {
-        int point_dir = calcPointDir( player );
-        serializer().serializeVisualPlayer( transport(),
-                                            player,
-                                            name,
-                                            dist,
-                                            dir,
-                                            point_dir );
-    }
-    else
-    {
-        serializer().serializeVisualPlayer( transport(),
-                                            player,
-                                            name,
-                                            dist,
-                                            dir );
-    }
-}
-
-
-/*!
-//===================================================================
 //
-//  CLASS: VisualSensorPlayerV13
+// the versions
 //
-//  DESC: Class for the version 13 visual protocol.  This version
-//        introduced observation of the kicking state of other players.
-//
-//===================================================================
-*/
 
-VisualSenderPlayerV13::VisualSenderPlayerV13( const Params & params )
-    : VisualSenderPlayerV8( params )
-{
-
-}
-
-VisualSenderPlayerV13::~VisualSenderPlayerV13()
-{
-
-}
+template class VisualSenderPlayerT< visual::LongNames,
+                                    visual::TruncatedDirs,
+                                    visual::PLAYER_DIR >;
+template class VisualSenderPlayerT< visual::LongNames,
+                                    visual::TruncatedDirs,
+                                    visual::PLAYER_BODY >;
+template class VisualSenderPlayerT< visual::LongNames,
+                                    visual::TruncatedDirs,
+                                    visual::PLAYER_HEAD >;
+template class VisualSenderPlayerT< visual::ShortNames,
+                                    visual::TruncatedDirs,
+                                    visual::PLAYER_HEAD >;
+template class VisualSenderPlayerT< visual::ShortNames,
+                                    visual::RoundedDirs,
+                                    visual::PLAYER_HEAD >;
+template class VisualSenderPlayerT< visual::ShortNames,
+                                    visual::RoundedDirs,
+                                    visual::PLAYER_ARM >;
 
 /*!
 //===================================================================
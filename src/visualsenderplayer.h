@@ -27,10 +27,12 @@
 #include "observer.h"
 #include "player.h"
 #include "random.h"
+#include "visualgeometry.h"
 
 #include <rcss/factory.hpp>
 
 #include <memory>
+#include <vector>
 
 class Stadium;
 
@@ -80,7 +82,9 @@ private:
     const Player & M_self;
     const Stadium & M_stadium;
 
-    int M_sendcnt;
+    //! own random stream, so that the visuals of different players can
+    //! be built in any order or in parallel with the same result
+    CounterRNG M_rng;
 
 public:
     typedef std::shared_ptr< VisualSenderPlayer > Ptr;
@@ -116,19 +120,9 @@ protected:
           return M_stadium;
       }
 
-    int sendCount() const
+    CounterRNG & rng()
       {
-          return M_sendcnt;
-      }
-
-    void incSendCount()
-      {
-          ++M_sendcnt;
-      }
-
-    void resetSendCount()
-      {
-          M_sendcnt = 0;
+          return M_rng;
       }
 
 };
@@ -173,156 +167,262 @@ public:
 /*!
 //===================================================================
 //
-//  CLASS: VisualSensorPlayerV1
-//
-//  DESC: Class for the version 1* visual protocol.  This version is
-//        completely unused as far as I am aware of, but it is here
-//        none the less, just in case there is someone somewhere
-//        still using it.
+//  CLASS: VisualSenderPlayerCommon
 //
-//        * It's version 1 to the simualtor in it's current form.
-//        From what I know the original simulator was written in
-//        lisp and the first C++ version was actually version 3.  I
-//        don't know if the protocol was compatible with previous
-//        versions, so this may well be the version 3 protocol.
+//  DESC: The parts of the visual protocol for players that are the
+//        same in all the versions: which objects are in the visual,
+//        their geometry and where the player sees the lines.
 //
 //===================================================================
 */
 
-class VisualSenderPlayerV1
+class VisualSenderPlayerCommon
     : public VisualSenderPlayer {
-public:
+protected:
 
-    VisualSenderPlayerV1( const Params & params );
+    VisualSenderPlayerCommon( const Params & params );
 
+public:
     virtual
-    ~VisualSenderPlayerV1() override;
+    ~VisualSenderPlayerCommon() override;
 
-    virtual
-    void sendVisual() override;
+protected:
 
+    void collectObjects();
 
-private:
-    void sendFlag( const PObject & obj )
+    void computeGeometry();
+
+    /*!
+      \brief calculate where the player sees a line
+      \param line the line
+      \param sight_2_line_ang the angle between the line of sight and
+      the normal of the line
+      \param player_2_line the perpendicular distance from the line
+      \return true if the player sees the line
+     */
+    bool calcLine( const PObject & line,
+                   double & sight_2_line_ang,
+                   double & player_2_line ) const;
+
+    double calcLineRadDir( const double & line_normal ) const
       {
-          (this->*M_send_flag)( obj );
+          return normalize_angle( line_normal
+                                  - self().angleBodyCommitted()
+                                  - self().angleNeckCommitted() );
       }
 
-    void sendBall( const MPObject & obj )
+    double calcQuantDist( const double & dist,
+                          const double & qstep ) const
       {
-          (this->*M_send_ball)( obj );
+          return Quantize( std::exp( Quantize( std::log( dist + EPS ), qstep ) ), 0.1 );
       }
 
-    void sendPlayer( const Player & obj )
+    double calcLineDist( const double & sight_2_line_ang,
+                         const double & player_2_line,
+                         const double & qstep ) const
       {
-          (this->*M_send_player)( obj );
+          return Quantize( std::exp( Quantize( std::log( std::fabs( player_2_line
+                                                                    / std::cos( sight_2_line_ang ) )
+                                                         + EPS ),
+                                               qstep ) ), 0.1 );
       }
 
-    void serializeLine( const std::string & name,
-                        const int dir,
-                        const double & sight_2_line_ang,
-                        const double & player_2_line )
+    bool decide( const double & prob )
       {
-          (this->*M_serialize_line)( name, dir,
-                                     sight_2_line_ang, player_2_line );
+          if ( prob >= 1.0 ) return true;
+          if ( prob <= 0.0 ) return false;
+          return rng().canonical() < prob;
       }
 
-    void sendFlags();
-
-    void sendBalls();
+    //! the landmarks that passed the view cone index
+    std::vector< std::size_t > M_landmark_candidates;
 
-    void sendPlayers();
+    //! the objects of the current visual, in the order they are sent
+    std::vector< const PObject * > M_flags;
+    const MPObject * M_ball;
+    std::vector< const Player * > M_players;
 
-    void sendLines();
-
-    void sendLowFlag( const PObject & flag );
-
-    void sendHighFlag( const PObject & flag );
+    //! flags first, then the ball, then the players
+    VisualGeometry M_geometry;
+};
 
-    void sendLowBall( const MPObject & ball );
 
-    void sendHighBall( const MPObject & ball );
+namespace visual {
 
-    void sendLowPlayer( const Player & player );
+/*!
+  \brief the policies for the parts of the protocol that differ
+  between the versions.  They are template arguments of
+  VisualSenderPlayerT, so that the loop over the objects of a visual
+  is compiled for each version without any indirect call besides those
+  into the serializer.
+ */
+
+//! the object names up to version 5
+struct LongNames {
+    static
+    const std::string & name( const PObject & obj )
+      {
+          return obj.name();
+      }
 
-    void sendHighPlayer( const Player & player );
+    static
+    const std::string & closeName( const PObject & obj )
+      {
+          return obj.closeName();
+      }
 
-    bool sendLine( const PObject & line );
+    static
+    const std::string & playerName( const Player & self,
+                                    const Player & obj )
+      {
+          return self.side() == obj.side()
+              ? obj.name()
+              : obj.fixedName();
+      }
 
-    void serializeLowLine( const std::string & name,
-                           const int dir,
-                           const double &,
-                           const double & );
+    static
+    const std::string & unumFarName( const Player & self,
+                                     const Player & obj )
+      {
+          return self.side() == obj.side()
+              ? obj.nameFar()
+              : obj.fixedNameFar();
+      }
 
-    void serializeHighLine( const std::string & name,
-                            const int dir,
-                            const double & sight_2_line_ang,
-                            const double & player_2_line );
+    static
+    const std::string & teamFarName( const Player & obj )
+      {
+          return obj.nameTooFar();
+      }
+};
 
-    double calcRadDir( const PObject & obj )
+//! the shortened object names since version 6
+struct ShortNames {
+    static
+    const std::string & name( const PObject & obj )
       {
-          return normalize_angle( self().angleFromBody( obj )
-                                  - self().angleNeckCommitted() );
+          return obj.shortName();
       }
 
-    int calcDegDir( const double & rad_dir ) const
+    static
+    const std::string & closeName( const PObject & obj )
       {
-          return rad2Deg( rad_dir );
+          return obj.shortCloseName();
       }
 
-    double calcLineRadDir( const double & line_normal ) const
+    static
+    const std::string & playerName( const Player & self,
+                                    const Player & obj )
       {
-          return normalize_angle( line_normal
-                                  - self().angleBodyCommitted()
-                                  - self().angleNeckCommitted() );
+          return self.side() == obj.side()
+              ? obj.shortName()
+              : obj.fixedShortName();
       }
 
-    int calcLineDir( const double & sight_2_line_ang ) const
+    static
+    const std::string & unumFarName( const Player & self,
+                                     const Player & obj )
       {
-          if ( sight_2_line_ang > 0 )
-              return calcDegDir( sight_2_line_ang - M_PI*0.5 );
-          else
-              return calcDegDir( sight_2_line_ang + M_PI*0.5 );
+          return self.side() == obj.side()
+              ? obj.shortNameFar()
+              : obj.fixedShortNameFar();
       }
 
-    double calcUnQuantDist( const PObject & obj ) const
+    static
+    const std::string & teamFarName( const Player & obj )
       {
-          return self().pos().distance( obj.pos() );
+          return obj.shortNameTooFar();
       }
+};
 
-    double calcQuantDist( const double & dist,
-                          const double & qstep ) const
+//! directions truncated to int, up to version 6
+struct TruncatedDirs {
+    static
+    int deg( const double & rad )
       {
-          return Quantize( std::exp( Quantize( std::log( dist + EPS ), qstep ) ), 0.1 );
+          return Rad2IDeg( rad );
       }
+};
 
-    double calcLineDist( const double & sight_2_line_ang,
-                         const double & player_2_line,
-                         const double & qstep ) const
+//! directions rounded to int, since version 7
+struct RoundedDirs {
+    static
+    int deg( const double & rad )
       {
-          return Quantize( std::exp( Quantize( std::log( std::fabs( player_2_line
-                                                                    / std::cos( sight_2_line_ang ) )
-                                                         + EPS ),
-                                               qstep ) ), 0.1 );
+          return Rad2IDegRound( rad );
       }
+};
 
+//! what is seen of another player besides its distance and direction
+enum PlayerFields {
+    PLAYER_DIR, //!< nothing more
+    PLAYER_BODY, //!< the body direction, since version 4
+    PLAYER_HEAD, //!< also the head direction, since version 5
+    PLAYER_ARM, //!< also the arm, the tackle and the kick, since version 8
+};
 
-    void calcVel( const PVector & obj_vel,
-                  const PVector & obj_pos,
-                  const double & un_quant_dist,
-                  const double & quant_dist,
-                  double & dist_chg,
-                  double & dir_chg ) const;
+}
 
-    bool decide( const double & prob )
-      {
-          if ( prob >= 1.0 ) return true;
-          if ( prob <= 0.0 ) return false;
-          return std::bernoulli_distribution( prob )( DefaultRNG::instance() );
-      }
+/*!
+//===================================================================
+//
+//  CLASS: VisualSenderPlayerT
+//
+//  DESC: The visual protocol for players, compiled for the naming,
+//        the rounding of directions and the player fields of a
+//        version.
+//
+//===================================================================
+*/
+
+template < typename Names,
+           typename Dirs,
+           visual::PlayerFields FIELDS >
+class VisualSenderPlayerT
+    : public VisualSenderPlayerCommon {
+public:
+
+    VisualSenderPlayerT( const Params & params );
 
-protected:
     virtual
+    ~VisualSenderPlayerT() override;
+
+    virtual
+    void sendVisual() override;
+
+private:
+
+    template < bool HIGH >
+    void sendObjects();
+
+    template < bool HIGH >
+    void sendLines();
+
+    //
+    // i is the index of the object in M_geometry
+    //
+
+    void sendLowFlag( const PObject & flag,
+                      const std::size_t i );
+
+    void sendHighFlag( const PObject & flag,
+                       const std::size_t i );
+
+    void sendLowBall( const MPObject & ball,
+                      const std::size_t i );
+
+    void sendHighBall( const MPObject & ball,
+                       const std::size_t i );
+
+    void sendLowPlayer( const Player & player,
+                        const std::size_t i );
+
+    void sendHighPlayer( const Player & player,
+                         const std::size_t i );
+
+    template < bool HIGH >
+    bool sendLine( const PObject & line );
+
     void serializePlayer( const Player & player,
                           const std::string & name,
                           const double & dist,
@@ -330,65 +430,64 @@ protected:
                           const double & dist_chg,
                           const double & dir_chg );
 
-    virtual
     void serializePlayer( const Player & player,
                           const std::string & name,
                           const double & dist,
                           const int dir );
 
-    virtual
-    int rad2Deg( const double & rad ) const
+    int calcDegDir( const double & rad_dir ) const
       {
-          return Rad2IDeg( rad );
+          return Dirs::deg( rad_dir );
       }
 
-    virtual
-    const
-    std::string & calcName( const PObject & obj ) const
+    int calcLineDir( const double & sight_2_line_ang ) const
       {
-          return obj.name();
+          if ( sight_2_line_ang > 0 )
+              return calcDegDir( sight_2_line_ang - M_PI*0.5 );
+          else
+              return calcDegDir( sight_2_line_ang + M_PI*0.5 );
       }
 
-    virtual
-    const
-    std::string & calcCloseName( const PObject & obj ) const
+    int calcBodyDir( const Player & player ) const
       {
-          return obj.closeName();
+          return calcDegDir( normalize_angle( player.angleBodyCommitted()
+                                              - self().angleBodyCommitted()
+                                              - self().angleNeckCommitted() ) );
       }
 
-    virtual
-    const std::string & calcPlayerName( const Player & obj ) const
+    int calcHeadDir( const Player & player ) const
       {
-          return self().side() == obj.side()
-              ? obj.name()
-              : obj.fixedName();
+          return calcDegDir( normalize_angle( player.angleNeckCommitted()
+                                              + player.angleBodyCommitted()
+                                              - self().angleBodyCommitted()
+                                              - self().angleNeckCommitted() ) );
       }
 
-    virtual
-    const
-    std::string & calcTFarName( const Player & obj ) const
-      {
-          return obj.nameTooFar();
-      }
+    int calcPointDir( const Player & player );
+};
 
-    virtual
-    const
-    std::string & calcUFarName( const Player & obj ) const
-      {
-          return self().side() == obj.side()
-              ? obj.nameFar()
-              : obj.fixedNameFar();
-      }
+/*!
+//===================================================================
+//
+//  CLASS: VisualSensorPlayerV1
+//
+//  DESC: Class for the version 1* visual protocol.  This version is
+//        completely unused as far as I am aware of, but it is here
+//        none the less, just in case there is someone somewhere
+//        still using it.
+//
+//        * It's version 1 to the simualtor in it's current form.
+//        From what I know the original simulator was written in
+//        lisp and the first C++ version was actually version 3.  I
+//        don't know if the protocol was compatible with previous
+//        versions, so this may well be the version 3 protocol.
+//
+//===================================================================
+*/
 
-private:
-    void (VisualSenderPlayerV1::*M_send_flag)( const PObject & );
-    void (VisualSenderPlayerV1::*M_send_ball)( const MPObject & );
-    void (VisualSenderPlayerV1::*M_send_player)( const Player & );
-    void (VisualSenderPlayerV1::*M_serialize_line)( const std::string &,
-                                                    const int,
-                                                    const double &,
-                                                    const double & );
-};
+typedef VisualSenderPlayerT< visual::LongNames,
+                             visual::TruncatedDirs,
+                             visual::PLAYER_DIR > VisualSenderPlayerV1;
 
 /*!
 //===================================================================
@@ -402,31 +501,9 @@ private:
 //===================================================================
 */
 
-class VisualSenderPlayerV4
-    : public VisualSenderPlayerV1 {
-public:
-    VisualSenderPlayerV4( const Params & params );
-
-    virtual
-    ~VisualSenderPlayerV4() override;
-
-protected:
-    virtual
-    void serializePlayer( const Player & player,
-                          const std::string & name,
-                          const double & dist,
-                          const int dir,
-                          const double & dist_chg,
-                          const double & dir_chg ) override;
-
-
-    int calcBodyDir( const Player & player ) const
-      {
-          return rad2Deg( normalize_angle( player.angleBodyCommitted()
-                                           - self().angleBodyCommitted()
-                                           - self().angleNeckCommitted() ) );
-      }
-};
+typedef VisualSenderPlayerT< visual::LongNames,
+                             visual::TruncatedDirs,
+                             visual::PLAYER_BODY > VisualSenderPlayerV4;
 
 /*!
 //===================================================================
@@ -440,33 +517,9 @@ protected:
 //===================================================================
 */
 
-class VisualSenderPlayerV5
-    : public VisualSenderPlayerV4 {
-public:
-    VisualSenderPlayerV5( const Params & params );
-
-    virtual
-    ~VisualSenderPlayerV5() override;
-
-protected:
-    virtual
-    void serializePlayer( const Player & player,
-                          const std::string & name,
-                          const double & dist,
-                          const int dir,
-                          const double & dist_chg,
-                          const double & dir_chg ) override;
-
-    int calcHeadDir( const Player & player ) const
-      {
-          return rad2Deg( normalize_angle( player.angleNeckCommitted()
-                                           + player.angleBodyCommitted()
-                                           - self().angleBodyCommitted()
-                                           - self().angleNeckCommitted() ) );
-      }
-
-};
-
+typedef VisualSenderPlayerT< visual::LongNames,
+                             visual::TruncatedDirs,
+                             visual::PLAYER_HEAD > VisualSenderPlayerV5;
 
 /*!
 //===================================================================
@@ -480,52 +533,9 @@ protected:
 //===================================================================
 */
 
-class VisualSenderPlayerV6
-    : public VisualSenderPlayerV5 {
-public:
-    VisualSenderPlayerV6( const Params & params );
-
-    virtual
-    ~VisualSenderPlayerV6() override;
-
-    virtual
-    const
-    std::string & calcName( const PObject & obj ) const override
-      {
-          return obj.shortName();
-      }
-
-    virtual
-    const
-    std::string & calcCloseName( const PObject & obj ) const override
-      {
-          return obj.shortCloseName();
-      }
-
-    virtual
-    const std::string & calcPlayerName( const Player & obj ) const override
-      {
-          return self().side() == obj.side()
-              ? obj.shortName()
-              : obj.fixedShortName();
-      }
-
-    virtual
-    const
-    std::string & calcUFarName( const Player & obj ) const override
-      {
-          return self().side() == obj.side()
-              ? obj.shortNameFar()
-              : obj.fixedShortNameFar();
-      }
-
-    virtual
-    const
-    std::string & calcTFarName( const Player & obj ) const override
-      {
-          return obj.shortNameTooFar();
-      }
-};
+typedef VisualSenderPlayerT< visual::ShortNames,
+                             visual::TruncatedDirs,
+                             visual::PLAYER_HEAD > VisualSenderPlayerV6;
 
 /*!
 //===================================================================
@@ -543,21 +553,9 @@ public:
 //===================================================================
 */
 
-class VisualSenderPlayerV7
-    : public VisualSenderPlayerV6 {
-public:
-    VisualSenderPlayerV7( const Params & params );
-
-    virtual
-    ~VisualSenderPlayerV7();
-
-protected:
-    virtual
-    int rad2Deg( const double & rad ) const override
-      {
-          return Rad2IDegRound( rad );
-      }
-};
+typedef VisualSenderPlayerT< visual::ShortNames,
+                             visual::RoundedDirs,
+                             visual::PLAYER_HEAD > VisualSenderPlayerV7;
 
 /*!
 //===================================================================
@@ -573,32 +571,9 @@ protected:
 //===================================================================
 */
 
-class VisualSenderPlayerV8
-    : public VisualSenderPlayerV7 {
-public:
-    VisualSenderPlayerV8( const Params & params );
-
-    virtual
-    ~VisualSenderPlayerV8();
-
-protected:
-    int calcPointDir( const Player & player );
-
-    virtual
-    void serializePlayer( const Player & player,
-                          const std::string & name,
-                          const double & dist,
-                          const int dir,
-                          const double & dist_chg,
-                          const double & dir_chg ) override;
-
-    virtual
-    void serializePlayer( const Player & player,
-                          const std::string & name,
-                          const double & dist,
-                          const int dir ) override;
-};
-
+typedef VisualSenderPlayerT< visual::ShortNames,
+                             visual::RoundedDirs,
+                             visual::PLAYER_ARM > VisualSenderPlayerV8;
 
 /*!
 //===================================================================
@@ -607,19 +582,13 @@ protected:
 //
 //  DESC: Class for the version 13 visual protocol.  This version
 //        introduced observation of the kicking state of other players.
+//        That is up to the serializer, the sender is the same as
+//        that of version 8.
 //
 //===================================================================
 */
 
-class VisualSenderPlayerV13
-    : public VisualSenderPlayerV8 {
-public:
-    VisualSenderPlayerV13( const Params & params );
-
-    virtual
-    ~VisualSenderPlayerV13();
-
-};
+typedef VisualSenderPlayerV8 VisualSenderPlayerV13;
 
 }
 
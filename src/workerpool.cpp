@@ -0,0 +1,161 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                workerpool.cpp
+                    Fork-join pool of simulation worker threads
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "workerpool.h"
+
+#include "utility.h"
+
+#include <iostream>
+
+WorkerPool::WorkerPool()
+    : M_job( nullptr ),
+      M_count( 0 ),
+      M_next( 0 ),
+      M_active( 0 ),
+      M_generation( 0 ),
+      M_stop( false )
+{
+
+}
+
+WorkerPool::~WorkerPool()
+{
+    stop();
+}
+
+std::size_t
+WorkerPool::start( const std::size_t threads )
+{
+    stop();
+
+    M_stop = false;
+    for ( std::size_t i = 0; i < threads; ++i )
+    {
+        try
+        {
+            M_threads.emplace_back( &WorkerPool::work, this );
+        }
+        catch ( std::exception & e )
+        {
+            std::cerr << __FILE__ << ": " << __LINE__
+                      << ": Error starting a worker thread: "
+                      << e.what() << std::endl;
+            break;
+        }
+    }
+
+    return M_threads.size();
+}
+
+void
+WorkerPool::stop()
+{
+    {
+        std::lock_guard< std::mutex > lock( M_mutex );
+        M_stop = true;
+    }
+    M_start_cond.notify_all();
+
+    for ( std::thread & t : M_threads )
+    {
+        t.join();
+    }
+    M_threads.clear();
+}
+
+void
+WorkerPool::run( const std::size_t count,
+                 const Job & job )
+{
+    if ( M_threads.empty()
+         || count <= 1 )
+    {
+        for ( std::size_t i = 0; i < count; ++i )
+        {
+            job( i );
+        }
+        return;
+    }
+
+    {
+        std::lock_guard< std::mutex > lock( M_mutex );
+        M_job = &job;
+        M_count = count;
+        M_next = 0;
+        M_active = M_threads.size();
+        ++M_generation;
+    }
+    M_start_cond.notify_all();
+
+    runJobs( job, count );
+
+    std::unique_lock< std::mutex > lock( M_mutex );
+    M_done_cond.wait( lock, [this] { return M_active == 0; } );
+    M_job = nullptr;
+}
+
+void
+WorkerPool::work()
+{
+    blockTerminationSignals();
+
+    unsigned long generation = 0;
+
+    std::unique_lock< std::mutex > lock( M_mutex );
+    for ( ; ; )
+    {
+        M_start_cond.wait( lock, [this, generation]
+                           {
+                               return M_stop || M_generation != generation;
+                           } );
+        if ( M_stop )
+        {
+            break;
+        }
+
+        generation = M_generation;
+        const Job & job = *M_job;
+        const std::size_t count = M_count;
+
+        lock.unlock();
+        runJobs( job, count );
+        lock.lock();
+
+        if ( --M_active == 0 )
+        {
+            M_done_cond.notify_one();
+        }
+    }
+}
+
+void
+WorkerPool::runJobs( const Job & job,
+                     const std::size_t count )
+{
+    for ( std::size_t i = M_next++; i < count; i = M_next++ )
+    {
+        job( i );
+    }
+}
@@ -0,0 +1,93 @@
+// -*-c++-*-
+
+/***************************************************************************
+                                 workerpool.h
+                    Fork-join pool of simulation worker threads
+                             -------------------
+    begin                : 2026-10-18
+    copyright            : (C) 2026 by The RoboCup Soccer Server
+                           Maintenance Group.
+    email                : sserver-admin@lists.sourceforge.net
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU LGPL as published by the Free Software  *
+ *   Foundation; either version 3 of the License, or (at your option) any  *
+ *   later version.                                                        *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RCSSSERVER_WORKERPOOL_H
+#define RCSSSERVER_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+/*!
+  \class WorkerPool
+  \brief threads that help the simulation thread to run independent
+  jobs.
+
+  run() hands out the job indices one at a time to the workers and the
+  calling thread, and returns when every job is done.  Without workers
+  the jobs run in index order on the calling thread.
+ */
+class WorkerPool {
+public:
+    typedef std::function< void( std::size_t ) > Job;
+
+private:
+    std::vector< std::thread > M_threads;
+
+    std::mutex M_mutex;
+    std::condition_variable M_start_cond;
+    std::condition_variable M_done_cond;
+
+    const Job * M_job; //!< the current job, valid while a run() is active
+    std::size_t M_count;
+    std::atomic< std::size_t > M_next; //!< next index to hand out
+    std::size_t M_active; //!< workers still busy with the current run()
+    unsigned long M_generation; //!< incremented for every run()
+    bool M_stop;
+
+    WorkerPool( const WorkerPool & ) = delete;
+    WorkerPool & operator=( const WorkerPool & ) = delete;
+
+public:
+    WorkerPool();
+
+    ~WorkerPool();
+
+    /*!
+      \brief start the given number of worker threads
+      \return the number of threads that could be started
+     */
+    std::size_t start( const std::size_t threads );
+
+    void stop();
+
+    //! the number of worker threads, not counting the caller of run()
+    std::size_t size() const
+      {
+          return M_threads.size();
+      }
+
+    //! call job( i ) for every i in [0, count) and wait for all of them
+    void run( const std::size_t count,
+              const Job & job );
+
+private:
+    void work();
+
+    void runJobs( const Job & job,
+                  const std::size_t count );
+};
+
+#endif